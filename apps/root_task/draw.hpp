@@ -69,11 +69,12 @@ void drive_draw_string(uint32_t *vram, const char *str, int x, int y, uint32_t c
 
 uintptr_t get_hw_addr(IUserRuntime *rt, const char *name)
 {
-    uintptr_t addr = 0;
-    Message m;
+    Message m{};
     m.type = MessageType::REQUEST_HARDWARE_INFO;
     m.payload[0] = (uintptr_t)name;
-    m.payload[1] = (uintptr_t)&addr;
-    rt->publish(m);
-    return addr;
+
+    Message reply{};
+    if (!rt->call(KERNEL_TASK_ID, m, reply))
+        return 0;
+    return reply.payload[0];
 }
\ No newline at end of file
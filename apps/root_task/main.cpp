@@ -30,6 +30,8 @@ extern "C" void main(IUserRuntime *rt)
         drive_draw_string(vram, banner, 20, 20, 0x00FF00, regs);
     }
 
+    // 没有消息时阻塞在信箱上，把 CPU 交给空闲循环，而不是反复让出空转
+    Message msg;
     while (true)
-        rt->yield();
+        rt->receive(msg);
 }
\ No newline at end of file
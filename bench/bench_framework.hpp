@@ -0,0 +1,136 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * 内核微基准框架
+ * 每个用例在同一批次内连续执行被测操作 N 次，记录该批次的 ns/op 作为一个样本。
+ * 批次大小自动标定，使单个样本足够长以摊薄计时开销；p50/p99 在样本之间统计。
+ */
+
+struct BenchResult
+{
+    std::string name;  // 用例名，如 heap.alloc_free
+    std::string param; // 参数描述，如 subscribers=16
+    size_t samples = 0;
+    size_t ops_per_sample = 0;
+    double ns_mean = 0;
+    double ns_p50 = 0;
+    double ns_p99 = 0;
+    double ns_min = 0;
+    double ops_per_sec = 0;
+};
+
+struct BenchOptions
+{
+    size_t samples = 200;               // 正式样本数
+    uint64_t min_sample_ns = 200 * 1000; // 单个样本的最短时长
+};
+
+class BenchContext
+{
+private:
+    const BenchOptions &_options;
+    BenchResult &_result;
+
+    template <typename F>
+    static uint64_t time_batch(F &batch, size_t n, size_t &ops)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        ops = batch(n);
+        auto end = std::chrono::steady_clock::now();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    }
+
+public:
+    BenchContext(const BenchOptions &options, BenchResult &result)
+        : _options(options), _result(result) {}
+
+    /**
+     * @brief 执行测量
+     * @param batch 形如 size_t(size_t n)：执行 n 轮被测逻辑，返回实际完成的操作数
+     */
+    template <typename F>
+    void run(F batch)
+    {
+        size_t ops = 0;
+
+        // 1. 标定批次大小（同时充当预热）
+        size_t n = 1;
+        while (n < (1u << 24) && time_batch(batch, n, ops) < _options.min_sample_ns)
+            n *= 2;
+
+        // 2. 正式采样
+        std::vector<double> per_op;
+        per_op.reserve(_options.samples);
+        for (size_t i = 0; i < _options.samples; ++i)
+        {
+            uint64_t ns = time_batch(batch, n, ops);
+            per_op.push_back(ops ? static_cast<double>(ns) / ops : 0.0);
+        }
+
+        // 3. 统计
+        std::sort(per_op.begin(), per_op.end());
+        double sum = 0;
+        for (double v : per_op)
+            sum += v;
+
+        _result.samples = per_op.size();
+        _result.ops_per_sample = ops;
+        _result.ns_mean = sum / per_op.size();
+        _result.ns_min = per_op.front();
+        _result.ns_p50 = per_op[per_op.size() / 2];
+        _result.ns_p99 = per_op[std::min(per_op.size() - 1, per_op.size() * 99 / 100)];
+        _result.ops_per_sec = _result.ns_mean > 0 ? 1e9 / _result.ns_mean : 0;
+    }
+};
+
+typedef std::function<void(BenchContext &)> BenchFunc;
+
+struct BenchCase
+{
+    std::string name;
+    std::string param;
+    BenchFunc func;
+};
+
+inline std::vector<BenchCase> &get_bench_registry()
+{
+    static std::vector<BenchCase> registry;
+    return registry;
+}
+
+inline void register_bench(const std::string &name, const std::string &param, BenchFunc func)
+{
+    get_bench_registry().push_back({name, param, func});
+}
+
+// 无参数用例
+#define K_BENCH_CASE(func, name) \
+    static bool func##_registered = []() { \
+        register_bench(name, "", func); \
+        return true; }()
+
+// 带参数用例：对每个参数值注册一次，func 签名为 void(BenchContext&, size_t)
+#define K_BENCH_CASE_ARGS(func, name, key, ...)                                              \
+    static bool func##_registered = []() {                                                   \
+        for (size_t arg : {__VA_ARGS__})                                                     \
+            register_bench(name, std::string(key) + "=" + std::to_string(arg),               \
+                           [arg](BenchContext &ctx) { func(ctx, arg); });                    \
+        return true; }()
+
+// 防止被测结果被编译器优化掉
+template <typename T>
+inline void bench_do_not_optimize(T const &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
@@ -0,0 +1,164 @@
+#include "bench_framework.hpp"
+#include <common/diagnostics.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+// 基准运行期间屏蔽内核日志，避免 I/O 干扰计时
+extern "C" void klog(LogLevel level, const char *fmt, ...)
+{
+}
+
+static void print_usage(const char *prog)
+{
+    std::cout << "Usage: " << prog << " [--filter <substr>] [--json <path>] [--csv <path>] [--quick]\n"
+              << "  --filter  只运行名称包含 substr 的用例\n"
+              << "  --json    将结果写入 JSON 文件，便于跨提交比较\n"
+              << "  --csv     将结果写入 CSV 文件\n"
+              << "  --quick   减少样本数，用于冒烟测试" << std::endl;
+}
+
+static std::string json_escape(const std::string &s)
+{
+    std::string out;
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+static const char *build_type()
+{
+#if defined(__OPTIMIZE__) || defined(NDEBUG)
+    return "optimized";
+#else
+    return "unoptimized";
+#endif
+}
+
+static const char *compiler_id()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+static bool write_json(const std::string &path, const std::vector<BenchResult> &results, const BenchOptions &options)
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+
+    out << "{\n";
+    out << "  \"suite\": \"kernel_bench\",\n";
+    out << "  \"build\": {\"type\": \"" << build_type() << "\", \"compiler\": \"" << json_escape(compiler_id()) << "\"},\n";
+    out << "  \"samples\": " << options.samples << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto &r = results[i];
+        out << std::fixed << std::setprecision(2);
+        out << "    {\"name\": \"" << json_escape(r.name) << "\", \"param\": \"" << json_escape(r.param)
+            << "\", \"samples\": " << r.samples << ", \"ops_per_sample\": " << r.ops_per_sample
+            << ", \"ns_per_op_mean\": " << r.ns_mean << ", \"ns_per_op_p50\": " << r.ns_p50
+            << ", \"ns_per_op_p99\": " << r.ns_p99 << ", \"ns_per_op_min\": " << r.ns_min
+            << ", \"ops_per_sec\": " << r.ops_per_sec << "}";
+        out << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return true;
+}
+
+static bool write_csv(const std::string &path, const std::vector<BenchResult> &results)
+{
+    std::ofstream out(path);
+    if (!out)
+        return false;
+
+    out << "name,param,samples,ops_per_sample,ns_per_op_mean,ns_per_op_p50,ns_per_op_p99,ns_per_op_min,ops_per_sec\n";
+    out << std::fixed << std::setprecision(2);
+    for (const auto &r : results)
+    {
+        out << r.name << "," << r.param << "," << r.samples << "," << r.ops_per_sample << ","
+            << r.ns_mean << "," << r.ns_p50 << "," << r.ns_p99 << "," << r.ns_min << "," << r.ops_per_sec << "\n";
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    BenchOptions options;
+    std::string filter;
+    std::string json_path;
+    std::string csv_path;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            json_path = argv[++i];
+        else if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+            csv_path = argv[++i];
+        else if (std::strcmp(argv[i], "--quick") == 0)
+        {
+            options.samples = 10;
+            options.min_sample_ns = 20 * 1000;
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    std::cout << std::left << std::setw(36) << "benchmark" << std::setw(18) << "param"
+              << std::right << std::setw(12) << "ns/op p50" << std::setw(12) << "ns/op p99"
+              << std::setw(14) << "ops/s" << std::endl;
+    std::cout << std::string(92, '-') << std::endl;
+
+    std::vector<BenchResult> results;
+    for (const auto &bench : get_bench_registry())
+    {
+        if (!filter.empty() && bench.name.find(filter) == std::string::npos)
+            continue;
+
+        BenchResult result;
+        result.name = bench.name;
+        result.param = bench.param;
+
+        BenchContext ctx(options, result);
+        bench.func(ctx);
+
+        std::cout << std::left << std::setw(36) << result.name << std::setw(18) << result.param
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << result.ns_p50 << std::setw(12) << result.ns_p99
+                  << std::setw(14) << std::setprecision(0) << result.ops_per_sec << std::endl;
+        results.push_back(result);
+    }
+
+    if (!json_path.empty() && !write_json(json_path, results, options))
+    {
+        std::cerr << "Failed to write " << json_path << std::endl;
+        return 1;
+    }
+    if (!csv_path.empty() && !write_csv(csv_path, results))
+    {
+        std::cerr << "Failed to write " << csv_path << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include "bench_framework.hpp"
+
+#include "suites/bench_context_switch.hpp"
+#include "suites/bench_scheduler.hpp"
+#include "suites/bench_message_bus.hpp"
+#include "suites/bench_mpsc.hpp"
+#include "suites/bench_ipc.hpp"
+#include "suites/bench_heap.hpp"
+#include "suites/bench_object_builder.hpp"
+#include "suites/bench_containers.hpp"
+
+// --- 上下文切换 ---
+K_BENCH_CASE(bench_context_transit_round_trip, "context.transit_round_trip");
+
+// --- 调度器 ---
+K_BENCH_CASE_ARGS(bench_scheduler_yield_round_robin, "scheduler.yield.round_robin", "tasks", 1, 4, 16, 64);
+K_BENCH_CASE_ARGS(bench_scheduler_yield_priority, "scheduler.yield.priority", "tasks", 1, 4, 16, 64);
+K_BENCH_CASE_ARGS(bench_strategy_ready_pick_round_robin, "strategy.ready_pick.round_robin", "tasks", 6, 64, 256);
+K_BENCH_CASE_ARGS(bench_strategy_ready_pick_priority, "strategy.ready_pick.priority", "tasks", 6, 64, 256);
+
+// --- 消息总线 ---
+K_BENCH_CASE_ARGS(bench_message_bus_publish_dispatch, "bus.publish_dispatch", "subscribers", 1, 4, 16, 64);
+K_BENCH_CASE_ARGS(bench_message_bus_batch_dispatch, "bus.batch_dispatch", "subscribers", 1, 4, 16, 64);
+K_BENCH_CASE_ARGS(bench_mpsc_ring_publish, "bus.mpsc_publish", "producers", 1, 2, 4, 8);
+
+// --- 点对点 IPC ---
+K_BENCH_CASE(bench_ipc_call_reply, "ipc.call_reply");
+K_BENCH_CASE(bench_ipc_send_receive, "ipc.send_receive");
+K_BENCH_CASE(bench_ipc_notify_wait, "ipc.notify_wait");
+K_BENCH_CASE(bench_ipc_stream_spsc, "ipc.stream_spsc");
+
+// --- 内核堆 ---
+K_BENCH_CASE_ARGS(bench_first_fit_lifo_small, "heap.first_fit.lifo_small", "live", 0, 256, 4096);
+K_BENCH_CASE_ARGS(bench_first_fit_random_mixed, "heap.first_fit.random_mixed", "live", 64, 1024, 4096);
+K_BENCH_CASE_ARGS(bench_tlsf_lifo_small, "heap.tlsf.lifo_small", "live", 0, 256, 4096);
+K_BENCH_CASE_ARGS(bench_tlsf_random_mixed, "heap.tlsf.random_mixed", "live", 64, 1024, 4096);
+
+// --- 对象构建器 ---
+K_BENCH_CASE_ARGS(bench_builder_node_churn_heap, "builder.node_churn.heap", "live", 64, 4096);
+K_BENCH_CASE_ARGS(bench_builder_node_churn_slab, "builder.node_churn.slab", "live", 64, 4096);
+
+// --- 基础容器 ---
+K_BENCH_CASE_ARGS(bench_id_generator_acquire, "id_generator.acquire_release", "fill", 0, 512, 1000);
+K_BENCH_CASE_ARGS(bench_kmap_find, "kmap.find", "entries", 8, 32, 64);
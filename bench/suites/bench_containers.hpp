@@ -0,0 +1,56 @@
+#pragma once
+
+#include "bench_framework.hpp"
+#include <kernel/BitmapIdGenerator.hpp>
+#include <kernel/KMap.hpp>
+#include <common/Resource.hpp>
+#include <cstdio>
+
+/**
+ * BitmapIdGenerator::acquire + release
+ * 预先占满前 fill 个 ID，测量位图扫描在不同占用率下的代价
+ */
+inline void bench_id_generator_acquire(BenchContext &ctx, size_t fill)
+{
+    BitmapIdGenerator<1024> gen;
+    for (size_t i = 0; i < fill; ++i)
+        gen.acquire();
+
+    ctx.run([&](size_t n)
+            {
+        for (size_t i = 0; i < n; ++i)
+        {
+            uint32_t id = gen.acquire();
+            bench_do_not_optimize(id);
+            gen.release(id);
+        }
+        return n; });
+}
+
+/**
+ * KMap::find：以 ResourceManager 的用法为模型 (const char* -> HardwareResource)
+ * 查找最后插入的键（最坏命中路径）
+ */
+inline void bench_kmap_find(BenchContext &ctx, size_t entries)
+{
+    static char names[64][16];
+    KMap<const char *, HardwareResource, 64> map;
+    for (size_t i = 0; i < entries; ++i)
+    {
+        std::snprintf(names[i], sizeof(names[i]), "DEVICE_%zu", i);
+        map.insert(names[i], HardwareResource{i * 0x1000, 0x1000, 0});
+    }
+
+    // 使用独立的字符串副本，确保走 strcmp 而非指针比较
+    char key[16];
+    std::snprintf(key, sizeof(key), "DEVICE_%zu", entries - 1);
+
+    ctx.run([&](size_t n)
+            {
+        for (size_t i = 0; i < n; ++i)
+        {
+            HardwareResource *res = map.find(key);
+            bench_do_not_optimize(res);
+        }
+        return n; });
+}
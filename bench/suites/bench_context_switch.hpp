@@ -0,0 +1,42 @@
+#pragma once
+
+#include "bench_framework.hpp"
+#include <simulator/HostTaskContext.hpp>
+#include <new>
+
+// 伙伴执行流：每次被切入后立即切回主流
+struct TransitPair
+{
+    HostTaskContext main_ctx;
+    HostTaskContext partner_ctx;
+};
+
+static void transit_partner_entry(void *pair_ptr, void *)
+{
+    auto *pair = static_cast<TransitPair *>(pair_ptr);
+    while (true)
+        pair->partner_ctx.transit_to(&pair->main_ctx);
+}
+
+/**
+ * ITaskContext::transit_to 往返：主流 -> 伙伴 -> 主流
+ * 一次操作 = 一次往返（两次物理切换）
+ */
+inline void bench_context_transit_round_trip(BenchContext &ctx)
+{
+    const size_t STACK_SIZE = 16 * 1024;
+    auto *stack = new (std::align_val_t{16}) uint8_t[STACK_SIZE];
+
+    TransitPair pair;
+    pair.partner_ctx.load_argument(0, reinterpret_cast<uintptr_t>(&pair));
+    pair.partner_ctx.setup_flow(transit_partner_entry, stack + STACK_SIZE);
+
+    ctx.run([&](size_t n)
+            {
+        for (size_t i = 0; i < n; ++i)
+            pair.main_ctx.transit_to(&pair.partner_ctx);
+        return n; });
+
+    // 伙伴停在自己的 transit_to 中，不会再被切入，可以直接回收栈
+    ::operator delete[](stack, std::align_val_t{16});
+}
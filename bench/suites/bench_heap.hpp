@@ -0,0 +1,124 @@
+#pragma once
+
+#include "bench_framework.hpp"
+#include <kernel/IAllocator.hpp>
+#include <kernel/KernelHeapAllocator.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <new>
+
+// 确定性的伪随机序列 (xorshift)，保证每次运行的分配模式一致
+struct BenchRandom
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+    uint64_t next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+const size_t BENCH_HEAP_SIZE = 16 * 1024 * 1024;
+
+template <typename Allocator>
+struct BenchHeap
+{
+    uint8_t *memory;
+    Allocator *heap;
+
+    BenchHeap()
+    {
+        memory = new (std::align_val_t{16}) uint8_t[BENCH_HEAP_SIZE];
+        heap = new (memory) Allocator(memory + sizeof(Allocator), BENCH_HEAP_SIZE - sizeof(Allocator));
+    }
+
+    ~BenchHeap()
+    {
+        ::operator delete[](memory, std::align_val_t{16});
+    }
+};
+
+/**
+ * 小对象 LIFO：分配后立即释放（ListNode 等短生命周期对象的典型模式）
+ * 一次操作 = 一次 allocate + 一次 deallocate
+ */
+template <typename Allocator>
+inline void bench_heap_lifo_small(BenchContext &ctx, size_t live)
+{
+    BenchHeap<Allocator> h;
+    IAllocator *heap = h.heap;
+
+    // 预先保留 live 个存活块，形成真实的块链长度
+    void *resident[4096];
+    for (size_t i = 0; i < live; ++i)
+        resident[i] = heap->allocate(32 + (i % 8) * 16);
+
+    ctx.run([&](size_t n)
+            {
+        for (size_t i = 0; i < n; ++i)
+        {
+            void *p = heap->allocate(48);
+            bench_do_not_optimize(p);
+            heap->deallocate(p, 48);
+        }
+        return n; });
+
+    for (size_t i = 0; i < live; ++i)
+        heap->deallocate(resident[i], 0);
+}
+
+/**
+ * 混合尺寸随机替换：维持 live 个存活块，每次随机释放一个并分配一个新尺寸
+ * 一次操作 = 一次 deallocate + 一次 allocate
+ */
+template <typename Allocator>
+inline void bench_heap_random_mixed(BenchContext &ctx, size_t live)
+{
+    BenchHeap<Allocator> h;
+    IAllocator *heap = h.heap;
+    BenchRandom rng;
+
+    void *slots[4096];
+    size_t sizes[4096];
+    for (size_t i = 0; i < live; ++i)
+    {
+        sizes[i] = 16 + rng.next() % 1024;
+        slots[i] = heap->allocate(sizes[i]);
+    }
+
+    ctx.run([&](size_t n)
+            {
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t idx = rng.next() % live;
+            heap->deallocate(slots[idx], sizes[idx]);
+            sizes[idx] = 16 + rng.next() % 1024;
+            slots[idx] = heap->allocate(sizes[idx]);
+        }
+        return n; });
+
+    for (size_t i = 0; i < live; ++i)
+        heap->deallocate(slots[i], sizes[i]);
+}
+
+inline void bench_first_fit_lifo_small(BenchContext &ctx, size_t live)
+{
+    bench_heap_lifo_small<KernelHeapAllocator>(ctx, live);
+}
+
+inline void bench_first_fit_random_mixed(BenchContext &ctx, size_t live)
+{
+    bench_heap_random_mixed<KernelHeapAllocator>(ctx, live);
+}
+
+inline void bench_tlsf_lifo_small(BenchContext &ctx, size_t live)
+{
+    bench_heap_lifo_small<TlsfHeapAllocator>(ctx, live);
+}
+
+inline void bench_tlsf_random_mixed(BenchContext &ctx, size_t live)
+{
+    bench_heap_random_mixed<TlsfHeapAllocator>(ctx, live);
+}
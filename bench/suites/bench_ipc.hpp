@@ -0,0 +1,231 @@
+#pragma once
+
+#include "bench_framework.hpp"
+#include <simulator/HostTaskContext.hpp>
+
+#include <kernel/KernelHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/SimpleTaskFactory.hpp>
+#include <kernel/KStackBuffer.hpp>
+#include <kernel/BitmapIdGenerator.hpp>
+#include <kernel/IpcService.hpp>
+#include <kernel/KernelProxy.hpp>
+#include <common/StreamRing.hpp>
+#include <new>
+
+/**
+ * IPC 往返：主流作为客户端，一个真实上下文的服务端任务负责应答
+ * 直接调用陷入门背后的 IpcService 入口（与内核陷入处理一致，只省去宿主信号本身的开销）
+ */
+struct IpcBenchEnv
+{
+    TaskScheduler *scheduler;
+    IpcService *ipc;
+    uint32_t request_note = 0; // 通知往返：客户端 -> 服务端
+    uint32_t reply_note = 0;   // 通知往返：服务端 -> 客户端
+};
+
+// call / reply_and_wait：两次直接移交，不经过就绪队列
+static void ipc_reply_server_entry(void *, void *config)
+{
+    auto *env = static_cast<IpcBenchEnv *>(config);
+    ITaskControlBlock *self = env->scheduler->get_current();
+
+    Message request{}, response{};
+    env->ipc->on_receive();
+    while (true)
+    {
+        env->ipc->try_receive(request);
+        response.payload[0] = request.payload[0] + 1;
+        self->ipc.partner = request.sender;
+        self->ipc.outgoing = &response;
+        env->ipc->on_reply();
+    }
+}
+
+// send + receive：唤醒经就绪队列，阻塞后由调度器挑选下一个任务
+static void ipc_echo_server_entry(void *, void *config)
+{
+    auto *env = static_cast<IpcBenchEnv *>(config);
+
+    Message request{};
+    while (true)
+    {
+        env->ipc->on_receive();
+        env->ipc->try_receive(request);
+        request.payload[0]++;
+        env->ipc->send(request.sender, request);
+    }
+}
+
+// notify + wait：只传递信号位，不复制消息
+static void ipc_notify_server_entry(void *, void *config)
+{
+    auto *env = static_cast<IpcBenchEnv *>(config);
+    ITaskControlBlock *self = env->scheduler->get_current();
+
+    while (true)
+    {
+        self->ipc.partner = env->request_note;
+        env->ipc->on_wait();
+        env->ipc->notify(env->reply_note, self->ipc.bits);
+    }
+}
+
+template <bool DirectCall>
+inline void bench_ipc_round_trip(BenchContext &ctx)
+{
+    const size_t HEAP_SIZE = 1024 * 1024;
+    auto *heap_mem = new (std::align_val_t{16}) uint8_t[HEAP_SIZE];
+    {
+        KernelHeapAllocator heap(heap_mem, HEAP_SIZE);
+        KernelObjectBuilder builder(&heap);
+        HostTaskContextFactory context_factory;
+        BitmapIdGenerator<64> id_gen;
+        SimpleTaskFactory factory(&builder, &context_factory, &id_gen);
+        SimpleTaskLifecycle lifecycle(&builder, &factory);
+        PriorityStrategy strategy;
+        PrioritySchedulingPolicy policy;
+        TaskScheduler scheduler(&strategy, &policy);
+        IpcService ipc(&lifecycle, &scheduler);
+        IpcBenchEnv env{&scheduler, &ipc};
+
+        TaskExecutionInfo main_exec{nullptr, nullptr, nullptr};
+        TaskResourceConfig main_res{TaskPriority::NORMAL, builder.construct<KStackBuffer>(&heap, 4096)};
+        ITaskControlBlock *client = lifecycle.spawn_task(main_exec, main_res);
+        scheduler.set_current(client);
+
+        TaskExecutionInfo exec{DirectCall ? ipc_reply_server_entry : ipc_echo_server_entry, nullptr, &env};
+        TaskResourceConfig res{TaskPriority::NORMAL, builder.construct<KStackBuffer>(&heap, 16 * 1024)};
+        ITaskControlBlock *server = lifecycle.spawn_task(exec, res);
+
+        // 让服务端先跑到等待请求的位置
+        strategy.make_task_ready(server);
+        scheduler.yield_current();
+
+        Message request{}, reply{};
+        ctx.run([&](size_t n)
+                {
+            for (size_t i = 0; i < n; ++i)
+            {
+                request.payload[0] = i;
+                if (DirectCall)
+                {
+                    client->ipc.partner = server->get_id();
+                    client->ipc.outgoing = &request;
+                    client->ipc.reply_buf = &reply;
+                    ipc.on_call();
+                }
+                else
+                {
+                    ipc.send(server->get_id(), request);
+                    ipc.on_receive();
+                    ipc.try_receive(reply);
+                }
+            }
+            bench_do_not_optimize(reply);
+            return n; });
+
+        // 服务端停在等待中，随堆一起丢弃
+    }
+    ::operator delete[](heap_mem, std::align_val_t{16});
+}
+
+inline void bench_ipc_call_reply(BenchContext &ctx)
+{
+    bench_ipc_round_trip<true>(ctx);
+}
+
+inline void bench_ipc_send_receive(BenchContext &ctx)
+{
+    bench_ipc_round_trip<false>(ctx);
+}
+
+inline void bench_ipc_notify_wait(BenchContext &ctx)
+{
+    const size_t HEAP_SIZE = 1024 * 1024;
+    auto *heap_mem = new (std::align_val_t{16}) uint8_t[HEAP_SIZE];
+    {
+        KernelHeapAllocator heap(heap_mem, HEAP_SIZE);
+        KernelObjectBuilder builder(&heap);
+        HostTaskContextFactory context_factory;
+        BitmapIdGenerator<64> id_gen;
+        SimpleTaskFactory factory(&builder, &context_factory, &id_gen);
+        SimpleTaskLifecycle lifecycle(&builder, &factory);
+        PriorityStrategy strategy;
+        PrioritySchedulingPolicy policy;
+        TaskScheduler scheduler(&strategy, &policy);
+        auto *notes = builder.construct<NotificationTable>();
+        IpcService ipc(&lifecycle, &scheduler, nullptr, notes);
+        IpcBenchEnv env{&scheduler, &ipc, notes->create(), notes->create()};
+
+        TaskExecutionInfo main_exec{nullptr, nullptr, nullptr};
+        TaskResourceConfig main_res{TaskPriority::NORMAL, builder.construct<KStackBuffer>(&heap, 4096)};
+        ITaskControlBlock *client = lifecycle.spawn_task(main_exec, main_res);
+        scheduler.set_current(client);
+
+        TaskExecutionInfo exec{ipc_notify_server_entry, nullptr, &env};
+        TaskResourceConfig res{TaskPriority::NORMAL, builder.construct<KStackBuffer>(&heap, 16 * 1024)};
+        ITaskControlBlock *server = lifecycle.spawn_task(exec, res);
+
+        strategy.make_task_ready(server);
+        scheduler.yield_current();
+
+        uint64_t bits = 0;
+        ctx.run([&](size_t n)
+                {
+            for (size_t i = 0; i < n; ++i)
+            {
+                ipc.notify(env.request_note, (i & 63) + 1);
+                client->ipc.partner = env.reply_note;
+                ipc.on_wait();
+                bits ^= client->ipc.bits;
+            }
+            bench_do_not_optimize(bits);
+            return n; });
+    }
+    ::operator delete[](heap_mem, std::align_val_t{16});
+}
+
+/**
+ * 流通道稳态：写端与读端交替搬运一个元素，两端都不进入内核
+ */
+inline void bench_ipc_stream_spsc(BenchContext &ctx)
+{
+    const size_t HEAP_SIZE = 256 * 1024;
+    auto *heap_mem = new (std::align_val_t{16}) uint8_t[HEAP_SIZE];
+    {
+        KernelHeapAllocator heap(heap_mem, HEAP_SIZE);
+        KernelObjectBuilder builder(&heap);
+        void *pool = heap.allocate(64 * 1024, 64);
+        auto *grants = builder.construct<BufferGrantTable>(pool, 64 * 1024);
+        auto *notes = builder.construct<NotificationTable>();
+        SimpleTaskLifecycle lifecycle(&builder, nullptr);
+        PriorityStrategy strategy;
+        TaskScheduler scheduler(&strategy, nullptr);
+        IpcService ipc(&lifecycle, &scheduler, grants, notes);
+        PlatformHooks hooks{};
+        KernelRuntimeProxy proxy(nullptr, &hooks, &scheduler, &ipc);
+
+        uint32_t handle = proxy.stream_create(sizeof(uint64_t), 256);
+        StreamWriter<uint64_t> writer(&proxy, handle);
+        StreamReader<uint64_t> reader(&proxy, handle);
+
+        uint64_t sum = 0;
+        ctx.run([&](size_t n)
+                {
+            uint64_t item = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                writer.try_write(static_cast<uint64_t>(i));
+                reader.try_read(item);
+                sum += item;
+            }
+            bench_do_not_optimize(sum);
+            return n; });
+    }
+    ::operator delete[](heap_mem, std::align_val_t{16});
+}
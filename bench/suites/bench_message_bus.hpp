@@ -0,0 +1,87 @@
+#pragma once
+
+#include "bench_framework.hpp"
+#include <kernel/KernelHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include <kernel/MessageBus.hpp>
+#include <new>
+
+static void bench_bus_counter(const Message &msg, void *ctx)
+{
+    ++*static_cast<size_t *>(ctx);
+}
+
+/**
+ * MessageBus::publish + dispatch_messages
+ * 注册表中预置若干无关类型，目标类型挂 N 个订阅者；
+ * 每轮发布一批消息后统一派发，一次操作 = 一条消息从发布到全部回调完成
+ */
+template <bool Batched>
+inline void bench_message_bus_burst(BenchContext &ctx, size_t subscribers)
+{
+    const size_t HEAP_SIZE = 1024 * 1024;
+    const size_t BURST = 16;
+    auto *heap_mem = new (std::align_val_t{16}) uint8_t[HEAP_SIZE];
+    {
+        KernelHeapAllocator heap(heap_mem, HEAP_SIZE);
+        KernelObjectBuilder builder(&heap);
+        MessageBus bus(&builder);
+
+        size_t delivered = 0;
+        size_t ignored = 0;
+
+        // 与内核启动后的注册表形态接近：目标类型排在其他类型之后
+        const MessageType others[] = {MessageType::SYS_LOAD_TASK, MessageType::KERNEL_EVENT,
+                                      MessageType::EVENT_KEYBOARD, MessageType::REQUEST_HARDWARE_INFO,
+                                      MessageType::EVENT_VRAM_UPDATED};
+        for (MessageType type : others)
+            bus.subscribe(type, MessageCallback(bench_bus_counter, &ignored));
+
+        // 每个订阅者使用不同的上下文，避免被视为同一个回调
+        size_t counters[64] = {};
+        for (size_t i = 0; i < subscribers; ++i)
+            bus.subscribe(MessageType::EVENT_PRINT, MessageCallback(bench_bus_counter, &counters[i]));
+
+        Message burst[BURST] = {};
+        for (auto &msg : burst)
+            msg.type = MessageType::EVENT_PRINT;
+
+        if (Batched)
+            bus.set_dispatch_mode(MessageBus::DispatchMode::GroupedByType);
+
+        ctx.run([&](size_t n)
+                {
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (Batched)
+                {
+                    bus.publish_batch(burst, BURST);
+                }
+                else
+                {
+                    for (size_t j = 0; j < BURST; ++j)
+                        bus.publish(burst[j]);
+                }
+                bus.dispatch_messages();
+            }
+            return n * BURST; });
+
+        for (size_t i = 0; i < subscribers; ++i)
+            delivered += counters[i];
+        bench_do_not_optimize(delivered);
+    }
+    ::operator delete[](heap_mem, std::align_val_t{16});
+}
+
+inline void bench_message_bus_publish_dispatch(BenchContext &ctx, size_t subscribers)
+{
+    bench_message_bus_burst<false>(ctx, subscribers);
+}
+
+/**
+ * 同上，但整批用 publish_batch 入队（一次 CAS），按类型分组分发（每批一次查表）
+ */
+inline void bench_message_bus_batch_dispatch(BenchContext &ctx, size_t subscribers)
+{
+    bench_message_bus_burst<true>(ctx, subscribers);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "bench_framework.hpp"
+#include <kernel/MpscRing.hpp>
+#include <common/Message.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/**
+ * MpscRing 多生产者投递
+ * 每批启动 P 个宿主线程，合计投递 n * ROUND 条消息（摊薄线程创建开销），当前线程作为唯一消费者批量取出；
+ * 一次操作 = 一条消息从投递到被消费。多核宿主上 ns/op 随生产者数增加而下降，直到消费者成为瓶颈；
+ * 单核宿主上生产者只能分时运行，结果只反映争用与线程切换开销
+ */
+inline void bench_mpsc_ring_publish(BenchContext &ctx, size_t producers)
+{
+    const size_t ROUND = 4096;
+    static MpscRing<Message, 1024> ring;
+
+    ctx.run([&](size_t n)
+            {
+        size_t per_producer = n * ROUND / producers;
+        std::atomic<size_t> finished{0};
+
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (size_t p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&, p]()
+                                 {
+                Message msg{};
+                msg.payload[0] = p;
+                for (size_t i = 0; i < per_producer; ++i)
+                {
+                    while (!ring.try_push(msg))
+                        std::this_thread::yield();
+                }
+                finished.fetch_add(1); });
+        }
+
+        size_t consumed = 0;
+        while (finished.load() < producers || ring.has_pending())
+        {
+            size_t got = ring.drain([&](const Message &m)
+                                    { consumed += m.payload[0] + 1; });
+            if (!got)
+                std::this_thread::yield();
+        }
+
+        for (auto &t : threads)
+            t.join();
+
+        bench_do_not_optimize(consumed);
+        return per_producer * producers; });
+}
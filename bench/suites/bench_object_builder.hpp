@@ -0,0 +1,48 @@
+#pragma once
+
+#include "bench_framework.hpp"
+#include "bench_heap.hpp"
+#include <kernel/KernelObjectBuilder.hpp>
+#include <kernel/KSlabCache.hpp>
+#include <kernel/KList.hpp>
+
+/**
+ * KernelObjectBuilder 构造/销毁链表节点：有无 slab 缓存对比
+ * 维持 live 个存活节点，每次随机替换一个
+ * 一次操作 = 一次 destroy + 一次 construct
+ */
+inline void bench_builder_node_churn(BenchContext &ctx, size_t live, bool use_slab)
+{
+    BenchHeap<TlsfHeapAllocator> h;
+    KSlabCacheTable caches(h.heap);
+    KernelObjectBuilder builder(h.heap, use_slab ? &caches : nullptr);
+    BenchRandom rng;
+
+    ListNode<Message> *nodes[4096];
+    Message msg{};
+    for (size_t i = 0; i < live; ++i)
+        nodes[i] = builder.construct<ListNode<Message>>(msg);
+
+    ctx.run([&](size_t n)
+            {
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t idx = rng.next() % live;
+            builder.destroy(nodes[idx]);
+            nodes[idx] = builder.construct<ListNode<Message>>(msg);
+        }
+        return n; });
+
+    for (size_t i = 0; i < live; ++i)
+        builder.destroy(nodes[i]);
+}
+
+inline void bench_builder_node_churn_heap(BenchContext &ctx, size_t live)
+{
+    bench_builder_node_churn(ctx, live, false);
+}
+
+inline void bench_builder_node_churn_slab(BenchContext &ctx, size_t live)
+{
+    bench_builder_node_churn(ctx, live, true);
+}
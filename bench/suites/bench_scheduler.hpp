@@ -0,0 +1,118 @@
+#pragma once
+
+#include "bench_framework.hpp"
+#include <simulator/HostTaskContext.hpp>
+
+#include <kernel/KernelHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include <kernel/RoundRobinStrategy.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/TaskScheduler.hpp>
+#include <kernel/SimpleTaskFactory.hpp>
+#include <kernel/KStackBuffer.hpp>
+#include <kernel/BitmapIdGenerator.hpp>
+#include <new>
+
+static void yield_task_entry(void *, void *scheduler)
+{
+    auto *sched = static_cast<TaskScheduler *>(scheduler);
+    while (true)
+        sched->yield_current();
+}
+
+/**
+ * TaskScheduler::yield_current：主流与 N 个忙让出任务轮转
+ * 一次操作 = 一次 yield（出队 + 入队 + 一次上下文切换）
+ */
+template <typename Strategy>
+inline void bench_scheduler_yield(BenchContext &ctx, size_t tasks)
+{
+    const size_t HEAP_SIZE = 4 * 1024 * 1024;
+    auto *heap_mem = new (std::align_val_t{16}) uint8_t[HEAP_SIZE];
+    {
+        KernelHeapAllocator heap(heap_mem, HEAP_SIZE);
+        KernelObjectBuilder builder(&heap);
+        HostTaskContextFactory context_factory;
+        BitmapIdGenerator<64> id_gen;
+        SimpleTaskFactory factory(&builder, &context_factory, &id_gen);
+        Strategy strategy;
+        TaskScheduler scheduler(&strategy, nullptr);
+
+        // 主流自身也需要一个 TCB 来保存被切走时的现场
+        TaskExecutionInfo main_exec{nullptr, nullptr, nullptr};
+        TaskResourceConfig main_res{TaskPriority::NORMAL, builder.construct<KStackBuffer>(&heap, 4096)};
+        ITaskControlBlock *main_tcb = factory.create_tcb(main_exec, main_res);
+        scheduler.set_current(main_tcb);
+
+        TaskExecutionInfo exec{yield_task_entry, nullptr, &scheduler};
+        TaskResourceConfig res[64];
+        for (size_t i = 0; i < tasks; ++i)
+        {
+            res[i] = TaskResourceConfig(TaskPriority::NORMAL, builder.construct<KStackBuffer>(&heap, 16 * 1024));
+            strategy.make_task_ready(factory.create_tcb(exec, res[i]));
+        }
+
+        ctx.run([&](size_t n)
+                {
+            for (size_t i = 0; i < n; ++i)
+                scheduler.yield_current();
+            return n * (tasks + 1); });
+
+        // 所有任务都停在 yield_current 中，随堆一起丢弃
+    }
+    ::operator delete[](heap_mem, std::align_val_t{16});
+}
+
+inline void bench_scheduler_yield_round_robin(BenchContext &ctx, size_t tasks)
+{
+    bench_scheduler_yield<RoundRobinStrategy>(ctx, tasks);
+}
+
+inline void bench_scheduler_yield_priority(BenchContext &ctx, size_t tasks)
+{
+    bench_scheduler_yield<PriorityStrategy>(ctx, tasks);
+}
+
+/**
+ * 策略层 make_task_ready + pick_next_ready_task（不含上下文切换）
+ * 就绪任务分散在所有优先级上，一次操作 = 一次出队 + 一次入队
+ */
+template <typename Strategy>
+inline void bench_strategy_ready_pick(BenchContext &ctx, size_t tasks)
+{
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock *tcbs[256];
+    for (size_t i = 0; i < tasks; ++i)
+    {
+        TaskResourceConfig res(static_cast<TaskPriority>(i % PriorityStrategy::PRIORITY_LEVELS), nullptr);
+        tcbs[i] = new SimpleTaskControlBlock(static_cast<uint32_t>(i), nullptr, exec, res);
+    }
+
+    Strategy strategy;
+    for (size_t i = 0; i < tasks; ++i)
+        strategy.make_task_ready(tcbs[i]);
+
+    ctx.run([&](size_t n)
+            {
+        for (size_t i = 0; i < n; ++i)
+        {
+            ITaskControlBlock *next = strategy.pick_next_ready_task();
+            strategy.make_task_ready(next);
+        }
+        return n; });
+
+    for (size_t i = 0; i < tasks; ++i)
+        delete tcbs[i];
+}
+
+inline void bench_strategy_ready_pick_round_robin(BenchContext &ctx, size_t tasks)
+{
+    bench_strategy_ready_pick<RoundRobinStrategy>(ctx, tasks);
+}
+
+inline void bench_strategy_ready_pick_priority(BenchContext &ctx, size_t tasks)
+{
+    bench_strategy_ready_pick<PriorityStrategy>(ctx, tasks);
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "Message.hpp"
+#include "IUserRuntime.hpp"
+
+/**
+ * Channel: 在编译期把 MessageType 与载荷类型 T 绑定，取代对 Message::payload 的 reinterpret_cast
+ * - T 必须可平凡复制、标准布局，且对齐不超过 payload：按字节复制进出消息
+ * - sizeof(T) 不超过 payload 时内联存放；更大的 T 自动改走缓冲授权 (Message::grant)：
+ *   总线分发时内核映射授权，把地址与尺寸放入 payload[0] / payload[1]，分发完成后释放
+ */
+template <MessageType TYPE, typename T>
+struct Channel
+{
+    using Payload = T;
+    static constexpr MessageType type = TYPE;
+    static constexpr bool INLINE = sizeof(T) <= sizeof(Message::payload);
+
+    static_assert(std::is_trivially_copyable<T>::value, "Channel payload must be trivially copyable");
+    static_assert(std::is_standard_layout<T>::value, "Channel payload must have standard layout");
+    static_assert(alignof(T) <= alignof(uint64_t), "Channel payload alignment exceeds the message payload");
+
+    /**
+     * @brief 构造内联消息（内核与任务均可使用）
+     */
+    static Message make(const T &value)
+    {
+        static_assert(INLINE, "Payload exceeds Message::payload; publish it through Channel::publish");
+        Message msg{};
+        msg.type = TYPE;
+        std::memcpy(msg.payload, &value, sizeof(T));
+        return msg;
+    }
+
+    /**
+     * @brief 按值取出内联载荷
+     */
+    static T read(const Message &msg)
+    {
+        static_assert(INLINE, "Out-of-line payloads must be accessed through Channel::view");
+        T value;
+        std::memcpy(&value, msg.payload, sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief 读取载荷：内联载荷复制到 storage，out-of-line 载荷直接指向已映射的缓冲区
+     * @return 载荷缺失（授权映射失败或尺寸不符）时返回 nullptr
+     */
+    static const T *view(const Message &msg, T &storage)
+    {
+        if constexpr (INLINE)
+        {
+            std::memcpy(&storage, msg.payload, sizeof(T));
+            return &storage;
+        }
+        else
+        {
+            if (!msg.grant || msg.payload[1] != sizeof(T))
+                return nullptr;
+            return reinterpret_cast<const T *>(static_cast<uintptr_t>(msg.payload[0]));
+        }
+    }
+
+    /**
+     * @brief 从任务投递到总线；超出 payload 的载荷先复制进新建的缓冲授权，随消息交给内核
+     */
+    static PublishResult publish(IUserRuntime *rt, const T &value)
+    {
+        if constexpr (INLINE)
+        {
+            return rt->publish(make(value));
+        }
+        else
+        {
+            uint32_t handle = rt->grant_create(sizeof(T));
+            void *buffer = handle ? rt->grant_map(handle) : nullptr;
+            if (!buffer)
+                return PublishResult::Full;
+
+            std::memcpy(buffer, &value, sizeof(T));
+            Message msg{};
+            msg.type = TYPE;
+            msg.grant = handle;
+
+            PublishResult result = rt->publish(msg);
+            if (result != PublishResult::Ok)
+                rt->grant_release(handle);
+            return result;
+        }
+    }
+};
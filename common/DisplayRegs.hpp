@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include "Channel.hpp"
 
 struct DisplayRegs
 {
@@ -10,3 +11,36 @@ struct DisplayRegs
     uint32_t status;  // 状态 (0: 准备就绪, 1: 正在刷新)
     uint32_t command; // 命令 (比如 1: 切换分辨率)
 };
+
+/**
+ * 脏矩形：EVENT_VRAM_UPDATED 的载荷，经 VramUpdatedChannel 收发
+ * 宽或高为 0 表示整屏（不带载荷的刷新请求即为整屏）
+ */
+struct DirtyRect
+{
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+
+    bool is_full() const { return width == 0 || height == 0; }
+
+    static DirtyRect full() { return {0, 0, 0, 0}; }
+
+    /**
+     * @brief 外接矩形并集；任一方为整屏时结果为整屏
+     */
+    DirtyRect unite(const DirtyRect &other) const
+    {
+        if (is_full() || other.is_full())
+            return full();
+
+        uint32_t left = x < other.x ? x : other.x;
+        uint32_t top = y < other.y ? y : other.y;
+        uint32_t right = x + width > other.x + other.width ? x + width : other.x + other.width;
+        uint32_t bottom = y + height > other.y + other.height ? y + height : other.y + other.height;
+        return {left, top, right - left, bottom - top};
+    }
+};
+
+using VramUpdatedChannel = Channel<MessageType::EVENT_VRAM_UPDATED, DirtyRect>;
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "IUserRuntime.hpp"
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free,
+              "Futex words must be plain lock-free 32-bit integers");
+
+namespace futex_detail
+{
+    inline const volatile uint32_t *word(const std::atomic<uint32_t> &value)
+    {
+        return reinterpret_cast<const volatile uint32_t *>(&value);
+    }
+}
+
+/**
+ * FutexMutex: 基于 futex 的互斥锁（三态：0 空闲，1 已加锁，2 已加锁且可能有等待者）
+ * - 无竞争时加锁 / 解锁各一次原子操作，不进入内核
+ * - 竞争时把状态置为 2 后经 futex_wait 睡眠；解锁发现 2 时才调用 futex_wake 唤醒一个等待者
+ * 可放在任务间共享的内存中；不可重入
+ */
+class FutexMutex
+{
+private:
+    std::atomic<uint32_t> _state{0};
+
+public:
+    bool try_lock()
+    {
+        uint32_t expected = 0;
+        return _state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void lock(IUserRuntime *rt)
+    {
+        uint32_t c = 0;
+        if (_state.compare_exchange_strong(c, 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return;
+
+        // 标记为有等待者后睡眠；醒来重新抢锁时仍按有等待者处理，保证解锁方不会漏掉唤醒
+        if (c != 2)
+            c = _state.exchange(2, std::memory_order_acquire);
+        while (c != 0)
+        {
+            rt->futex_wait(futex_detail::word(_state), 2);
+            c = _state.exchange(2, std::memory_order_acquire);
+        }
+    }
+
+    void unlock(IUserRuntime *rt)
+    {
+        if (_state.fetch_sub(1, std::memory_order_release) != 1)
+        {
+            _state.store(0, std::memory_order_release);
+            rt->futex_wake(futex_detail::word(_state), 1);
+        }
+    }
+
+    bool is_locked() const { return _state.load(std::memory_order_relaxed) != 0; }
+};
+
+/**
+ * FutexCondition: 基于序号的条件变量
+ * 等待方记下序号后释放互斥锁并睡眠；通知方递增序号，只在可能有等待者时进入内核
+ */
+class FutexCondition
+{
+private:
+    std::atomic<uint32_t> _seq{0};
+    std::atomic<uint32_t> _waiters{0};
+
+public:
+    /**
+     * @brief 释放 mutex 并等待通知，返回前重新持有 mutex；可能虚假唤醒，调用方须复查条件
+     * @return 超时返回 false
+     */
+    bool wait(IUserRuntime *rt, FutexMutex &mutex, uint32_t timeout_ms = 0)
+    {
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        mutex.unlock(rt);
+
+        FutexWaitResult result = rt->futex_wait(futex_detail::word(_seq), seq, timeout_ms);
+
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        mutex.lock(rt);
+        return result != FutexWaitResult::TimedOut;
+    }
+
+    void notify_one(IUserRuntime *rt) { notify(rt, 1); }
+    void notify_all(IUserRuntime *rt) { notify(rt, UINT32_MAX); }
+
+private:
+    void notify(IUserRuntime *rt, uint32_t count)
+    {
+        // 与等待方“读序号、登记、比较序号”配对：要么看到登记而唤醒，要么等待方看到新序号不睡眠
+        _seq.fetch_add(1, std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_seq_cst))
+            rt->futex_wake(futex_detail::word(_seq), count);
+    }
+};
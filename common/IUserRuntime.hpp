@@ -1,10 +1,76 @@
 #pragma once
 
+#include <cstddef>
 #include "Message.hpp"
 
+// 内核自身的服务端点：ID 0 由任务 ID 分配器保留，不会分配给任何任务
+static const uint32_t KERNEL_TASK_ID = 0;
+
+enum class FutexWaitResult : uint8_t
+{
+    Woken,        // 被 futex_wake 唤醒
+    ValueChanged, // 陷入时值已不等于期望值，没有睡眠
+    TimedOut      // 超时仍未被唤醒
+};
+
 class IUserRuntime
 {
 public:
-    virtual void publish(const Message &msg) = 0;
+    // 投递到消息总线；队列已满时立即返回 Full
+    virtual PublishResult publish(const Message &msg) = 0;
+    // 阻塞投递：队列已满时阻塞到分发者腾出空间后再投递；内核无法阻塞调用方时返回 Full
+    virtual PublishResult publish_wait(const Message &msg) = 0;
+    // 批量发布：一次进入内核投递整批消息，返回实际接收的数量
+    virtual size_t publish_batch(const Message *msgs, size_t count) = 0;
     virtual void yield() = 0;
+
+    // 睡眠：精度为一个时钟节拍，到期后回到就绪队列；期间不占用 CPU
+    virtual void sleep_for(uint32_t ms) = 0;
+    // 睡眠到 now_ms() 时间轴上的 deadline_ms；已过期时立即返回
+    virtual void sleep_until(uint64_t deadline_ms) = 0;
+    // 内核启动以来的毫秒数（随时钟节拍推进）
+    virtual uint64_t now_ms() = 0;
+
+    // 点对点投递到目标任务的信箱；目标不存在或信箱已满时返回 false
+    virtual bool send(uint32_t task_id, const Message &msg) = 0;
+    // 取出本任务信箱中的下一条消息；信箱为空时阻塞，直到有消息到达
+    virtual void receive(Message &out) = 0;
+
+    // 同步调用：发送请求并阻塞到目标回复，CPU 直接交给等待中的服务端；目标不存在或信箱已满时返回 false
+    virtual bool call(uint32_t task_id, const Message &msg, Message &reply) = 0;
+    // 服务端：回复 client_id 的 call 并等待下一条请求（next.sender 为下一位调用方）；client 不在等待回复时返回 false
+    virtual bool reply_and_wait(uint32_t client_id, const Message &reply, Message &next) = 0;
+
+    // 缓冲授权：从内核专用池分配大块缓冲区，句柄放入 Message::grant 即可零拷贝地交给接收方
+    // 创建者持有一个引用；池耗尽时返回 0
+    virtual uint32_t grant_create(uint32_t size) = 0;
+    // 映射到可访问的地址；本任务未持有该授权时返回 nullptr
+    virtual void *grant_map(uint32_t handle, uint32_t *size = nullptr) = 0;
+    // 为自己再添一个引用：随消息移交后本任务仍可访问（共享）
+    virtual bool grant_retain(uint32_t handle) = 0;
+    // 释放一个引用；最后一个引用释放后缓冲区归还内核
+    virtual bool grant_release(uint32_t handle) = 0;
+
+    // 通知对象：只携带 64 位信号位的轻量唤醒，不分配、不排队；表满时返回 0
+    virtual uint32_t notification_create() = 0;
+    // 仍有任务等待时返回 false
+    virtual bool notification_destroy(uint32_t handle) = 0;
+    // 把 bits 或进待处理位并唤醒等待者；句柄无效时返回 false
+    virtual bool notify(uint32_t handle, uint64_t bits) = 0;
+    // 取走并清空累积的位；没有时阻塞到 notify 到达。句柄无效时返回 0
+    virtual uint64_t notification_wait(uint32_t handle) = 0;
+    // 非阻塞版本：没有累积的位时返回 0
+    virtual uint64_t notification_poll(uint32_t handle) = 0;
+
+    // futex：*addr 仍等于 expected 时睡眠，直到 futex_wake 或超时（timeout_ms 为 0 表示不限时）
+    // 无竞争时用户态只做原子操作，不必调用这里（见 Futex.hpp）
+    virtual FutexWaitResult futex_wait(const volatile uint32_t *addr, uint32_t expected, uint32_t timeout_ms = 0) = 0;
+    // 唤醒至多 count 个等在 addr 上的任务，返回实际唤醒的数量
+    virtual uint32_t futex_wake(const volatile uint32_t *addr, uint32_t count) = 0;
+
+    // 流通道：在缓冲授权中建立 capacity 个槽位的 SPSC 环（见 StreamRing.hpp），返回授权句柄；
+    // capacity 须为 2 的幂。经 grant_retain + send 交给对端，两端分别构造 StreamWriter / StreamReader
+    virtual uint32_t stream_create(uint32_t element_size, uint32_t capacity) = 0;
+    // 销毁环的通知对象并释放本任务的引用；须在两端都停止使用后调用
+    virtual bool stream_destroy(uint32_t handle) = 0;
 };
\ No newline at end of file
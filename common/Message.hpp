@@ -12,8 +12,18 @@ enum class MessageType : uint32_t
     EVENT_VRAM_UPDATED = 0x300,
 };
 
+// 投递结果
+enum class PublishResult : uint8_t
+{
+    Ok,     // 已入队，或已并入同类型的待分发消息
+    Full,   // 队列已达容量上限，未入队；稍后重试或使用阻塞投递
+    Dropped // 被丢弃且重试无效（例如运行时没有消息总线）
+};
+
 struct alignas(16) Message
 {
     MessageType type;
     uint64_t payload[4];
+    uint32_t sender; // 点对点 IPC 由内核填入发送方任务 ID；总线消息不使用
+    uint32_t grant;  // 随点对点消息移交的缓冲授权句柄（0 表示无）：投递时发送方的一个引用转给接收方
 };
\ No newline at end of file
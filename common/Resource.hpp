@@ -1,5 +1,5 @@
 #include <cstdint>
-#pragma
+#pragma once
 
 struct HardwareResource
 {
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "IUserRuntime.hpp"
+
+/**
+ * StreamRing: 任务间共享内存中的单生产者/单消费者环形通道
+ * - 由内核 (IUserRuntime::stream_create) 在缓冲授权里建立：头部之后紧跟 capacity 个元素槽，
+ *   创建者把授权句柄随消息交给对端 (grant_retain + send)，双方各自映射同一块内存
+ * - 稳态下读写只操作两端游标，不进入内核；环空 / 环满时置位等待标志，
+ *   经内核通知对象阻塞，对端看到标志后 notify 唤醒
+ * - 游标自由递增，下标 = 游标 & (capacity - 1)；两端各占独立缓存行，避免伪共享
+ */
+struct StreamRingHeader
+{
+    static const uint32_t MAGIC = 0x53524E47; // "SRNG"
+    static const uint32_t CACHE_LINE = 64;
+
+    alignas(CACHE_LINE) std::atomic<uint32_t> tail{0}; // 生产者写
+    std::atomic<uint32_t> producer_waiting{0};         // 生产者等待空位
+    alignas(CACHE_LINE) std::atomic<uint32_t> head{0}; // 消费者写
+    std::atomic<uint32_t> consumer_waiting{0};         // 消费者等待数据
+
+    alignas(CACHE_LINE) uint32_t magic = MAGIC;
+    uint32_t capacity = 0; // 槽位数，2 的幂
+    uint32_t element_size = 0;
+    uint32_t data_note = 0;  // 生产者 -> 消费者的通知句柄
+    uint32_t space_note = 0; // 消费者 -> 生产者的通知句柄
+
+    // 授权尺寸是 32 位：环头加全部槽位不得超过该值
+    static const uint64_t MAX_BYTES = UINT32_MAX;
+
+    /**
+     * @brief 环头加 capacity 个槽位的总字节数；以 64 位计算，调用方须与 MAX_BYTES 比较
+     */
+    static uint64_t bytes_for(uint32_t element_size, uint32_t capacity)
+    {
+        return sizeof(StreamRingHeader) + static_cast<uint64_t>(element_size) * capacity;
+    }
+
+    /**
+     * @brief 几何是否合法：元素非空、容量为不小于 2 的 2 的幂、总尺寸可放进一个授权
+     */
+    static bool geometry_ok(uint32_t element_size, uint32_t capacity)
+    {
+        return element_size && capacity >= 2 && !(capacity & (capacity - 1)) &&
+               bytes_for(element_size, capacity) <= MAX_BYTES;
+    }
+
+    uint8_t *slot(uint32_t pos)
+    {
+        return reinterpret_cast<uint8_t *>(this + 1) + (pos & (capacity - 1)) * element_size;
+    }
+};
+
+static_assert(sizeof(StreamRingHeader) % StreamRingHeader::CACHE_LINE == 0, "Ring slots must start on a cache line");
+
+namespace stream_detail
+{
+    /**
+     * @brief 映射授权并校验环头与元素尺寸；环头位于共享内存中，几何参数按不可信输入复查
+     */
+    inline StreamRingHeader *attach(IUserRuntime *rt, uint32_t handle, uint32_t element_size)
+    {
+        uint32_t size = 0;
+        auto *ring = static_cast<StreamRingHeader *>(rt->grant_map(handle, &size));
+        if (!ring || size < sizeof(StreamRingHeader) || ring->magic != StreamRingHeader::MAGIC ||
+            ring->element_size != element_size || !StreamRingHeader::geometry_ok(element_size, ring->capacity) ||
+            size < StreamRingHeader::bytes_for(element_size, ring->capacity))
+            return nullptr;
+        return ring;
+    }
+
+    /**
+     * @brief 发布一端游标后检查对端是否在等待（与等待方的“置标志再复查”构成 Dekker 式配对，避免丢失唤醒）
+     */
+    inline void kick(IUserRuntime *rt, std::atomic<uint32_t> &waiting, uint32_t note)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed) && waiting.exchange(0, std::memory_order_relaxed))
+            rt->notify(note, 1);
+    }
+}
+
+/**
+ * 生产者端：只允许一个任务持有
+ */
+template <typename T>
+class StreamWriter
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Stream elements must be trivially copyable");
+
+private:
+    IUserRuntime *_rt;
+    StreamRingHeader *_ring;
+    uint32_t _tail = 0;
+    uint32_t _cached_head = 0; // 消费者游标的本地副本：只在看似已满时重新读取
+
+public:
+    StreamWriter(IUserRuntime *rt, uint32_t handle)
+        : _rt(rt), _ring(stream_detail::attach(rt, handle, sizeof(T)))
+    {
+        if (_ring)
+        {
+            _tail = _ring->tail.load(std::memory_order_relaxed);
+            _cached_head = _ring->head.load(std::memory_order_acquire);
+        }
+    }
+
+    bool valid() const { return _ring != nullptr; }
+
+    /**
+     * @brief 写入尽可能多的元素，整批只发布一次游标
+     * @return 实际写入的数量；环满时为 0
+     */
+    size_t try_write(const T *items, size_t count)
+    {
+        if (!_ring || !count)
+            return 0;
+
+        uint32_t room = _ring->capacity - (_tail - _cached_head);
+        if (room < count)
+        {
+            _cached_head = _ring->head.load(std::memory_order_acquire);
+            room = _ring->capacity - (_tail - _cached_head);
+        }
+
+        size_t n = count < room ? count : room;
+        for (size_t i = 0; i < n; ++i)
+            std::memcpy(_ring->slot(_tail + static_cast<uint32_t>(i)), &items[i], sizeof(T));
+        if (!n)
+            return 0;
+
+        _tail += static_cast<uint32_t>(n);
+        _ring->tail.store(_tail, std::memory_order_release);
+        stream_detail::kick(_rt, _ring->consumer_waiting, _ring->data_note);
+        return n;
+    }
+
+    bool try_write(const T &item) { return try_write(&item, 1) == 1; }
+
+    /**
+     * @brief 阻塞写入全部元素：环满时经通知对象等待消费者腾出空间
+     */
+    void write(const T *items, size_t count)
+    {
+        while (_ring && count)
+        {
+            size_t n = try_write(items, count);
+            items += n;
+            count -= n;
+            if (count)
+                wait_for_space();
+        }
+    }
+
+    void write(const T &item) { write(&item, 1); }
+
+private:
+    void wait_for_space()
+    {
+        _ring->producer_waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        _cached_head = _ring->head.load(std::memory_order_acquire);
+        if (_tail - _cached_head == _ring->capacity)
+            _rt->notification_wait(_ring->space_note);
+        _ring->producer_waiting.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * 消费者端：只允许一个任务持有
+ */
+template <typename T>
+class StreamReader
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Stream elements must be trivially copyable");
+
+private:
+    IUserRuntime *_rt;
+    StreamRingHeader *_ring;
+    uint32_t _head = 0;
+    uint32_t _cached_tail = 0; // 生产者游标的本地副本：只在看似为空时重新读取
+
+public:
+    StreamReader(IUserRuntime *rt, uint32_t handle)
+        : _rt(rt), _ring(stream_detail::attach(rt, handle, sizeof(T)))
+    {
+        if (_ring)
+        {
+            _head = _ring->head.load(std::memory_order_relaxed);
+            _cached_tail = _ring->tail.load(std::memory_order_acquire);
+        }
+    }
+
+    bool valid() const { return _ring != nullptr; }
+
+    /**
+     * @brief 取出至多 max 个元素，整批只发布一次游标
+     * @return 实际取出的数量；环空时为 0
+     */
+    size_t try_read(T *out, size_t max)
+    {
+        if (!_ring || !max)
+            return 0;
+
+        if (_cached_tail == _head)
+            _cached_tail = _ring->tail.load(std::memory_order_acquire);
+
+        uint32_t avail = _cached_tail - _head;
+        size_t n = max < avail ? max : avail;
+        for (size_t i = 0; i < n; ++i)
+            std::memcpy(&out[i], _ring->slot(_head + static_cast<uint32_t>(i)), sizeof(T));
+        if (!n)
+            return 0;
+
+        _head += static_cast<uint32_t>(n);
+        _ring->head.store(_head, std::memory_order_release);
+        stream_detail::kick(_rt, _ring->producer_waiting, _ring->space_note);
+        return n;
+    }
+
+    bool try_read(T &out) { return try_read(&out, 1) == 1; }
+
+    /**
+     * @brief 阻塞读取：环空时经通知对象等待生产者，返回至少一个元素
+     */
+    size_t read(T *out, size_t max)
+    {
+        while (_ring && max)
+        {
+            size_t n = try_read(out, max);
+            if (n)
+                return n;
+            wait_for_data();
+        }
+        return 0;
+    }
+
+    void read(T &out) { read(&out, 1); }
+
+private:
+    void wait_for_data()
+    {
+        _ring->consumer_waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        _cached_tail = _ring->tail.load(std::memory_order_acquire);
+        if (_cached_tail == _head)
+            _rt->notification_wait(_ring->data_note);
+        _ring->consumer_waiting.store(0, std::memory_order_relaxed);
+    }
+};
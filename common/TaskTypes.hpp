@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <string>
 
+#include "Channel.hpp"
+
 enum class TaskPriority : uint8_t
 {
     IDLE = 0,     // 空闲任务，最低优先级
@@ -34,6 +36,14 @@ struct TaskExecutionInfo
     void *config; // 任务私有配置
 };
 
+// CPU 亲和性掩码：第 N 位表示允许在 CPU N 上运行
+typedef uint32_t CpuMask;
+const CpuMask CPU_MASK_ALL = 0xFFFFFFFFu;
+// 内核只驱动一个 CPU（CPU 0）：亲和性不含它的任务永远不会被调度
+const CpuMask CPU_MASK_ONLINE = 0x1u;
+
+inline CpuMask cpu_mask_of(uint32_t cpu) { return CpuMask(1) << cpu; }
+
 /**
  * TaskResourceConfig: 定义任务的资源约束
  */
@@ -43,12 +53,14 @@ struct TaskResourceConfig
 {
     TaskPriority priority;
     KStackBuffer *stack; // 不再是裸指针，而是受管对象
+    CpuMask affinity;    // 允许运行的 CPU；只含一位即绑定到该 CPU。创建时与在线 CPU 取交集，交集为空则拒绝创建
+    uint32_t mailbox_capacity; // 信箱槽位数（2 的幂）；不超过 TCB 内嵌容量时为 0，沿用内嵌槽位
 
     TaskResourceConfig()
-        : priority(TaskPriority::NORMAL), stack(nullptr) {}
+        : priority(TaskPriority::NORMAL), stack(nullptr), affinity(CPU_MASK_ALL), mailbox_capacity(0) {}
 
-    TaskResourceConfig(TaskPriority priority, KStackBuffer *stack)
-        : priority(priority), stack(stack) {}
+    TaskResourceConfig(TaskPriority priority, KStackBuffer *stack, CpuMask affinity = CPU_MASK_ALL, uint32_t mailbox_capacity = 0)
+        : priority(priority), stack(stack), affinity(affinity), mailbox_capacity(mailbox_capacity) {}
 };
 
 /**
@@ -59,4 +71,7 @@ struct TaskSpawnParams
 {
     TaskExecutionInfo exec_info;   // 逻辑：代码在哪里，用什么运行时
     TaskResourceConfig res_config; // 资源：给多少内存，优先级多高
-};
\ No newline at end of file
+};
+
+// SYS_LOAD_TASK 的载荷：超出 Message::payload，经缓冲授权随消息交给内核
+using TaskSpawnChannel = Channel<MessageType::SYS_LOAD_TASK, TaskSpawnParams>;
\ No newline at end of file
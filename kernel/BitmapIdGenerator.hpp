@@ -32,7 +32,7 @@ public:
             if (_bitmap[i] != 0xFFFFFFFFFFFFFFFF)
             {
                 // 找到第一个为 0 的位 (x64 环境下可用编译器内建函数优化)
-                int bit_pos = KernelUtils::Bit::find_first_set(_bitmap[i]);
+                int bit_pos = KernelUtils::Bit::find_first_set(~_bitmap[i]);
                 uint32_t id = static_cast<uint32_t>(i * 64 + bit_pos);
 
                 if (id < MAX_ID_COUNT)
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "TlsfHeapAllocator.hpp"
+
+/**
+ * BufferGrantTable: 任务间零拷贝大块数据的授权表
+ * - 缓冲区来自专用区域上的独立 TLSF 池，与内核对象堆隔离：授权泄漏不会挤占内核对象
+ * - 句柄 = 世代号 << INDEX_BITS | (记录下标 + 1)；记录回收后世代号递增，陈旧句柄一律失效
+ * - 引用按持有任务计数：只有持有者才能映射、转移或释放；最后一个引用释放时缓冲区归还池
+ *
+ * 与 Mailbox 相同，只在陷入门或 PreemptGuard 临界区内访问，不加锁
+ */
+class BufferGrantTable
+{
+public:
+    static const uint32_t MAX_GRANTS = 64;
+    static const uint32_t MAX_HOLDERS = 4; // 同一缓冲区最多同时被几个任务持有
+    static const uint32_t INDEX_BITS = 8;
+    static const uint32_t INVALID_HANDLE = 0;
+    static const size_t BUFFER_ALIGN = 64; // 缓冲区按缓存行对齐
+
+private:
+    struct Holder
+    {
+        uint32_t task_id;
+        uint32_t refs; // 0 表示空位
+    };
+
+    struct Record
+    {
+        void *base = nullptr; // 为空表示记录空闲
+        uint32_t size = 0;
+        uint32_t generation = 1;
+        uint32_t next_free = 0; // 空闲链：下一条空闲记录的下标 + 1
+        Holder holders[MAX_HOLDERS] = {};
+    };
+
+    TlsfHeapAllocator _pool;
+    Record _records[MAX_GRANTS];
+    uint32_t _free_head = 0; // 下标 + 1，0 表示没有空闲记录
+    uint32_t _live = 0;
+
+public:
+    /**
+     * @param region 专用于授权缓冲的内存区域
+     */
+    BufferGrantTable(void *region, size_t size) : _pool(region, size)
+    {
+        for (uint32_t i = MAX_GRANTS; i > 0; --i)
+        {
+            _records[i - 1].next_free = _free_head;
+            _free_head = i;
+        }
+    }
+
+    BufferGrantTable(const BufferGrantTable &) = delete;
+    BufferGrantTable &operator=(const BufferGrantTable &) = delete;
+
+    /**
+     * @brief 从池中分配缓冲区，owner 持有唯一的引用
+     * @return 池或记录耗尽时返回 INVALID_HANDLE
+     */
+    uint32_t create(uint32_t size, uint32_t owner)
+    {
+        if (size == 0 || !_free_head)
+            return INVALID_HANDLE;
+
+        void *base = _pool.allocate(size, BUFFER_ALIGN);
+        if (!base)
+            return INVALID_HANDLE;
+
+        uint32_t index = _free_head - 1;
+        Record &record = _records[index];
+        _free_head = record.next_free;
+
+        record.base = base;
+        record.size = size;
+        record.holders[0] = {owner, 1};
+        _live++;
+        return (record.generation << INDEX_BITS) | (index + 1);
+    }
+
+    /**
+     * @return task 未持有该授权时返回 nullptr
+     */
+    void *map(uint32_t handle, uint32_t task, uint32_t *size = nullptr)
+    {
+        Record *record = lookup(handle);
+        if (!record || !find_holder(*record, task))
+            return nullptr;
+
+        if (size)
+            *size = record->size;
+        return record->base;
+    }
+
+    /**
+     * @brief task 为自己再添一个引用（共享前先保留一份，转移后自己仍可访问）
+     */
+    bool retain(uint32_t handle, uint32_t task)
+    {
+        Record *record = lookup(handle);
+        Holder *holder = record ? find_holder(*record, task) : nullptr;
+        if (!holder)
+            return false;
+
+        holder->refs++;
+        return true;
+    }
+
+    /**
+     * @brief 检查 from 的一个引用能否移交给 to（投递前调用，避免投递失败后回滚）
+     */
+    bool can_transfer(uint32_t handle, uint32_t from, uint32_t to)
+    {
+        Record *record = lookup(handle);
+        if (!record || !find_holder(*record, from))
+            return false;
+        return find_holder(*record, to) || find_holder(*record, 0, true);
+    }
+
+    /**
+     * @brief 把 from 的一个引用移交给 to，引用总数不变
+     */
+    bool transfer(uint32_t handle, uint32_t from, uint32_t to)
+    {
+        if (!can_transfer(handle, from, to))
+            return false;
+
+        Record &record = *lookup(handle);
+        Holder *dst = find_holder(record, to);
+        if (!dst)
+        {
+            dst = find_holder(record, 0, true);
+            *dst = {to, 0};
+        }
+        dst->refs++;
+        drop(record, *find_holder(record, from));
+        return true;
+    }
+
+    /**
+     * @brief 释放 task 的一个引用；最后一个引用释放时缓冲区归还池，句柄失效
+     */
+    bool release(uint32_t handle, uint32_t task)
+    {
+        Record *record = lookup(handle);
+        Holder *holder = record ? find_holder(*record, task) : nullptr;
+        if (!holder)
+            return false;
+
+        drop(*record, *holder);
+        return true;
+    }
+
+    /**
+     * @brief 回收 task 持有的全部引用（任务销毁时调用）
+     * @return 释放的引用数
+     */
+    uint32_t release_all(uint32_t task)
+    {
+        uint32_t released = 0;
+        for (Record &record : _records)
+        {
+            Holder *holder = record.base ? find_holder(record, task) : nullptr;
+            if (!holder)
+                continue;
+
+            released += holder->refs;
+            holder->refs = 1;
+            drop(record, *holder);
+        }
+        return released;
+    }
+
+    uint32_t live_count() const { return _live; }
+
+    /**
+     * @brief 该授权的引用总数（无效句柄为 0）
+     */
+    uint32_t ref_count(uint32_t handle)
+    {
+        Record *record = lookup(handle);
+        if (!record)
+            return 0;
+
+        uint32_t refs = 0;
+        for (const Holder &holder : record->holders)
+            refs += holder.refs;
+        return refs;
+    }
+
+private:
+    Record *lookup(uint32_t handle)
+    {
+        uint32_t index = handle & ((1u << INDEX_BITS) - 1);
+        if (index == 0 || index > MAX_GRANTS)
+            return nullptr;
+
+        Record &record = _records[index - 1];
+        if (!record.base || record.generation != (handle >> INDEX_BITS))
+            return nullptr;
+        return &record;
+    }
+
+    /**
+     * @param vacant 为 true 时查找空位而不是 task 的条目
+     */
+    static Holder *find_holder(Record &record, uint32_t task, bool vacant = false)
+    {
+        for (Holder &holder : record.holders)
+        {
+            if (vacant ? holder.refs == 0 : (holder.refs && holder.task_id == task))
+                return &holder;
+        }
+        return nullptr;
+    }
+
+    void drop(Record &record, Holder &holder)
+    {
+        holder.refs--;
+        for (const Holder &h : record.holders)
+        {
+            if (h.refs)
+                return;
+        }
+
+        // 最后一个引用：缓冲区归还池，记录换代后回到空闲链
+        _pool.deallocate(record.base, record.size);
+        record.base = nullptr;
+        record.size = 0;
+        record.generation = (record.generation + 1) & ((1u << (32 - INDEX_BITS)) - 1);
+        if (record.generation == 0)
+            record.generation = 1;
+        record.next_free = _free_head;
+        _free_head = static_cast<uint32_t>(&record - _records) + 1;
+        _live--;
+    }
+};
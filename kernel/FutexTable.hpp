@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+
+#include "TaskScheduler.hpp"
+#include "WaitQueue.hpp"
+
+/**
+ * FutexTable: 按用户地址散列的等待队列表
+ * - 等待者记下自己等待的地址 (ipc.futex_addr)，挂到该地址所在桶的 WaitQueue 上；
+ *   不同地址可能落在同一个桶里，唤醒时只挑地址相符的等待者
+ * - 用户态在无竞争时只做原子操作，不进入内核；只有需要睡眠或唤醒睡眠者时才调用这里
+ *
+ * 与 WaitQueue 相同，wait 只在陷入门内调用，wake 在陷入门或 PreemptGuard 临界区内调用
+ */
+class FutexTable
+{
+public:
+    static const uint32_t BUCKET_BITS = 6;
+    static const uint32_t BUCKETS = 1u << BUCKET_BITS;
+
+private:
+    WaitQueue _buckets[BUCKETS];
+    uint64_t _waits = 0;
+    uint64_t _wakes = 0;
+
+public:
+    FutexTable() = default;
+    FutexTable(const FutexTable &) = delete;
+    FutexTable &operator=(const FutexTable &) = delete;
+
+    /**
+     * @brief 陷入：*addr 仍等于 expected 时阻塞当前任务，直到 wake 或截止时间到达
+     * 陷入期间中断被屏蔽：比较与入队之间不会插入 wake，不会丢失唤醒
+     * @param deadline_ms 截止时刻（调度器时间），0 表示不限时
+     * @return 值已改变、已过截止时间或无法交出 CPU 时返回 false
+     */
+    bool wait(TaskScheduler &scheduler, const volatile uint32_t *addr, uint32_t expected, uint64_t deadline_ms = 0)
+    {
+        ITaskControlBlock *current = scheduler.get_current();
+        if (!current || !addr || *addr != expected)
+            return false;
+
+        // futex_addr 只在任务挂在桶上时被 wake 比较，返回后无需清除
+        _waits++;
+        current->ipc.futex_addr = addr;
+        return scheduler.block_on(bucket_of(addr), deadline_ms);
+    }
+
+    /**
+     * @brief 按等待顺序唤醒至多 count 个等在 addr 上的任务
+     * @return 实际唤醒的数量
+     */
+    uint32_t wake(TaskScheduler &scheduler, const volatile uint32_t *addr, uint32_t count)
+    {
+        WaitQueue &bucket = bucket_of(addr);
+        uint32_t woken = 0;
+        bucket.for_each([&](ITaskControlBlock *task)
+                        {
+            if (woken < count && task->ipc.futex_addr == addr && scheduler.wake(task))
+                woken++; });
+
+        _wakes += woken;
+        return woken;
+    }
+
+    uint64_t wait_count() const { return _waits; }
+    uint64_t wake_count() const { return _wakes; }
+
+private:
+    WaitQueue &bucket_of(const volatile uint32_t *addr)
+    {
+        // 地址低两位恒为零；乘法散列取高位
+        uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(addr)) >> 2;
+        return _buckets[(key * 0x9E3779B97F4A7C15ull) >> (64 - BUCKET_BITS)];
+    }
+};
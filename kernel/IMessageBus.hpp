@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <common/Message.hpp>
 #include "MessageCallback.hpp"
 
@@ -8,8 +9,11 @@ class IMessageBus
 public:
     virtual ~IMessageBus() = default;
 
-    // 发布消息
-    virtual void publish(const Message &msg) = 0;
+    // 发布消息：队列达到容量上限时返回 Full，消息未入队
+    virtual PublishResult publish(const Message &msg) = 0;
+
+    // 批量发布：一次入队整批消息；返回实际接收的数量，其余被丢弃
+    virtual size_t publish_batch(const Message *msgs, size_t count) = 0;
 
     // 订阅消息（通常配合回调接口或 Lambda）
     virtual void subscribe(MessageType type, MessageCallback cb) = 0;
@@ -17,5 +21,18 @@ public:
     // 取消订阅
     virtual void unsubscribe(MessageType type, MessageCallback cb) = 0;
 
+    // 类型化订阅：消息类型取自通道，处理函数的参数类型必须与通道载荷一致
+    template <typename Ch, typename C, void (C::*Handler)(const typename Ch::Payload &)>
+    void subscribe_channel(C *obj) { subscribe(Ch::type, channel_callback<Ch, C, Handler>(obj)); }
+
+    template <typename Ch, typename C, void (C::*Handler)(const typename Ch::Payload &)>
+    void unsubscribe_channel(C *obj) { unsubscribe(Ch::type, channel_callback<Ch, C, Handler>(obj)); }
+
     virtual void dispatch_messages() = 0;
+
+    // 是否有尚未分发的消息（空闲循环入睡前的复查）
+    virtual bool has_pending() const = 0;
+
+    // 该类型的消息此刻能否入队（近似值，供阻塞投递判断是否需要等待）
+    virtual bool has_room(MessageType type) const = 0;
 };
\ No newline at end of file
@@ -2,10 +2,34 @@
 
 #include <utility>
 #include <new>
+#include <type_traits>
 
 #include "IAllocator.hpp"
 #include <common/PlacementNew.hpp>
 
+/**
+ * 类型标识：每个类型对应一个唯一的静态地址，用作对象缓存的键（无需 RTTI）
+ */
+template <typename T>
+struct ObjectTypeTag
+{
+    static constexpr char id = 0;
+};
+
+/**
+ * 固定尺寸、频繁创建的内核对象通过 `static constexpr bool SLAB_CACHED = true;` 声明，
+ * 由 Builder 路由到该类型专属的对象缓存
+ */
+template <typename T, typename = void>
+struct is_slab_cached : std::false_type
+{
+};
+
+template <typename T>
+struct is_slab_cached<T, std::void_t<decltype(T::SLAB_CACHED)>> : std::integral_constant<bool, T::SLAB_CACHED>
+{
+};
+
 class IObjectBuilder
 {
 protected:
@@ -13,6 +37,19 @@ protected:
 
     virtual void on_object_created() = 0;
 
+    /**
+     * 缓存对象的分配/归还钩子：默认直接走 Allocator，具体 Builder 可接入对象缓存
+     */
+    virtual void *allocate_cached(const void *type_key, size_t size, size_t alignment)
+    {
+        return _allocator->allocate(size, alignment);
+    }
+
+    virtual void release_cached(const void *type_key, void *ptr, size_t size)
+    {
+        _allocator->deallocate(ptr, size);
+    }
+
 public:
     IObjectBuilder(IAllocator *alloc) : _allocator(alloc) {}
     virtual ~IObjectBuilder() = default;
@@ -23,8 +60,13 @@ public:
     template <typename T, typename... Args>
     T *construct(Args &&...args)
     {
-        // 1. 调用 Allocator 分配空间
-        void *ptr = _allocator->allocate(sizeof(T), alignof(T));
+        // 1. 分配空间：声明了 SLAB_CACHED 的类型走对象缓存
+        void *ptr = nullptr;
+        if constexpr (is_slab_cached<T>::value)
+            ptr = allocate_cached(&ObjectTypeTag<T>::id, sizeof(T), alignof(T));
+        else
+            ptr = _allocator->allocate(sizeof(T), alignof(T));
+
         if (!ptr)
             return nullptr;
 
@@ -32,8 +74,39 @@ public:
         return new (ptr) T(std::forward<Args>(args)...);
     }
 
+    /**
+     * 构建连续数组：元素逐个默认构造，不经过对象缓存（数组尺寸不固定）
+     */
+    template <typename T>
+    T *construct_array(size_t count)
+    {
+        if (count == 0)
+            return nullptr;
+
+        void *ptr = _allocator->allocate(sizeof(T) * count, alignof(T));
+        if (!ptr)
+            return nullptr;
+
+        T *items = static_cast<T *>(ptr);
+        for (size_t i = 0; i < count; ++i)
+            new (&items[i]) T();
+        return items;
+    }
+
+    template <typename T>
+    void destroy_array(T *items, size_t count)
+    {
+        if (!items)
+            return;
+
+        for (size_t i = 0; i < count; ++i)
+            items[i].~T();
+        _allocator->deallocate(items, sizeof(T) * count);
+    }
+
     /**
      * 销毁对象并归还内存
+     * 注意：T 必须是构造时的实际类型，缓存对象按类型归还
      */
     template <typename T>
     void destroy(T *ptr)
@@ -45,6 +118,9 @@ public:
         ptr->~T();
 
         // 2. 归还内存给 Allocator
-        _allocator->deallocate(ptr, sizeof(T));
+        if constexpr (is_slab_cached<T>::value)
+            release_cached(&ObjectTypeTag<T>::id, ptr, sizeof(T));
+        else
+            _allocator->deallocate(ptr, sizeof(T));
     }
-};
\ No newline at end of file
+};
@@ -1,9 +1,15 @@
 #pragma once
 
+#include "SignalType.hpp"
+
 // 只负责切换和让出执行权的最小接口
 struct ISchedulingControl
 {
     virtual void yield_current_task() = 0;
     virtual void terminate_current_task() = 0;
+    // 陷入内核，若当前任务信箱仍为空则转入 BLOCKED，直到有消息投递
+    virtual void block_current_task() = 0;
+    // 陷入内核执行带参数的调用（SignalEvent::Call / Reply / Wait / Sleep），参数已暂存在当前 TCB 中
+    virtual void invoke_ipc(SignalEvent op) = 0;
     virtual ~ISchedulingControl() = default;
 };
\ No newline at end of file
@@ -6,9 +6,18 @@ struct ISchedulingStrategy
     // 决策：谁是下一个？
     virtual ITaskControlBlock *pick_next_ready_task() = 0;
 
+    // 查询：下一个会被选中的任务（不出队），供抢占判断使用
+    virtual ITaskControlBlock *peek_next_ready_task() const = 0;
+
     // 更新：这个任务现在可以跑了，请归队
     virtual void make_task_ready(ITaskControlBlock *tcb) = 0;
 
     // 可选：任务退出时通知策略移除它
     virtual void remove_task(ITaskControlBlock *tcb) = 0;
+
+    // 亲和性不含任何在线 CPU 的任务无处可跑，策略拒绝让它归队
+    static bool runs_online(const ITaskControlBlock *tcb)
+    {
+        return (tcb->get_resource_config().affinity & CPU_MASK_ONLINE) != 0;
+    }
 };
\ No newline at end of file
@@ -1,9 +1,50 @@
 #pragma once
 
+#include <cstring>
+
 #include "ITaskContext.hpp"
+#include "IntrusiveList.hpp"
+#include "Mailbox.hpp"
 #include "common/TaskTypes.hpp"
 #include <common/IUserRuntime.hpp>
 
+/**
+ * 时间片记账：由 TaskScheduler 在时钟节拍中维护
+ */
+struct TaskSliceAccount
+{
+    uint32_t remaining_ms = 0; // 当前时间片剩余，耗尽后在下次被调度时按策略重新发放
+    uint64_t ticks = 0;        // 累计在 CPU 上度过的节拍数
+    uint32_t preemptions = 0;  // 被时钟中断强制切走的次数
+};
+
+/**
+ * IPC 等待原因：区分阻塞在 receive 上的服务端与阻塞在 call 上等待回复的客户端
+ */
+enum class IpcWait : uint8_t
+{
+    None,
+    Receive,
+    Reply,
+    Notification
+};
+
+/**
+ * IPC 陷入参数：任务在陷入前暂存于此，由 IpcService 在陷入门内读取（相当于系统调用寄存器）
+ */
+struct TaskIpcState
+{
+    IpcWait wait = IpcWait::None;
+    bool ok = false;                   // 最近一次 call / reply 的结果
+    uint32_t partner = 0;              // call 的目标 / reply 的客户端；等待回复期间为服务端；wait 的通知句柄；publish_wait 的消息类型
+    const Message *outgoing = nullptr; // 待发送的请求或回复
+    Message *reply_buf = nullptr;      // call 方接收回复的位置（位于调用方栈上）
+    uint64_t bits = 0;                 // wait 返回时取走的通知位
+
+    const volatile uint32_t *futex_addr = nullptr; // futex 等待的地址（挂在 FutexTable 上时有效）
+    uint32_t futex_expected = 0;                   // futex_wait 陷入参数：期望值
+};
+
 /**
  * TCB (Task Control Block) 抽象
  * 它是内核管理任务的实体，只负责状态和上下文，不负责具体的业务逻辑
@@ -14,6 +55,23 @@ private:
     char _name[32];
 
 public:
+    // 调度挂钩：TCB 同一时刻只位于一条调度链表（就绪队列等）上，入队/出队无需分配节点
+    IntrusiveListNode sched_link;
+
+    // 定时器挂钩：睡眠或限时等待期间挂在 TimerWheel 的槽上；wake_at_ms 为截止时刻（毫秒，调度器时间）
+    IntrusiveListNode timer_link;
+    uint64_t wake_at_ms = 0;
+    bool wait_timed_out = false; // 最近一次 WaitQueue 等待是否因截止时间到达而返回
+
+    // 时间片记账：只由调度器读写
+    TaskSliceAccount slice;
+
+    // 私有信箱：由 IpcService 投递，任务通过 IUserRuntime::receive 取出
+    Mailbox mailbox;
+
+    // 同步 IPC 状态：只由 IpcService 与本任务的运行时代理读写
+    TaskIpcState ipc;
+
     virtual ~ITaskControlBlock() = default;
 
     virtual uint32_t get_id() const = 0;
@@ -41,7 +99,6 @@ public:
     virtual const TaskResourceConfig &get_resource_config() const = 0;
 
     virtual ITaskContext *get_context() const = 0;
+};
 
-    virtual bool is_queued() const = 0;
-    virtual void set_queued(bool queued) = 0;
-};
\ No newline at end of file
+typedef IntrusiveList<ITaskControlBlock, &ITaskControlBlock::sched_link> TaskQueue;
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * 侵入式链表挂钩：嵌入在宿主对象内部，入队/出队只交换指针，不分配任何内存
+ * 同一时刻一个挂钩只能挂在一条链表上，owner 记录当前所属链表
+ */
+struct IntrusiveListNode
+{
+    IntrusiveListNode *prev = nullptr;
+    IntrusiveListNode *next = nullptr;
+    const void *owner = nullptr;
+
+    bool is_linked() const { return owner != nullptr; }
+};
+
+/**
+ * IntrusiveList: 基于哨兵的双向循环链表
+ * @tparam T 宿主类型
+ * @tparam Hook 宿主中 IntrusiveListNode 成员的成员指针
+ */
+template <typename T, IntrusiveListNode T::*Hook>
+class IntrusiveList
+{
+private:
+    IntrusiveListNode _sentinel;
+    size_t _size = 0;
+
+    static IntrusiveListNode *hook_of(T *item)
+    {
+        return &(item->*Hook);
+    }
+
+    // 通过成员指针反推宿主地址（container_of）
+    static T *owner_of(IntrusiveListNode *node)
+    {
+        const uintptr_t probe = 0x1000;
+        const uintptr_t offset = reinterpret_cast<uintptr_t>(&(reinterpret_cast<T *>(probe)->*Hook)) - probe;
+        return reinterpret_cast<T *>(reinterpret_cast<uintptr_t>(node) - offset);
+    }
+
+    void link_between(IntrusiveListNode *node, IntrusiveListNode *prev, IntrusiveListNode *next)
+    {
+        node->prev = prev;
+        node->next = next;
+        node->owner = this;
+        prev->next = node;
+        next->prev = node;
+        _size++;
+    }
+
+    void unlink(IntrusiveListNode *node)
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        node->prev = node->next = nullptr;
+        node->owner = nullptr;
+        _size--;
+    }
+
+public:
+    IntrusiveList()
+    {
+        _sentinel.prev = _sentinel.next = &_sentinel;
+    }
+
+    // 挂钩内保存了指向哨兵的指针，链表不可拷贝
+    IntrusiveList(const IntrusiveList &) = delete;
+    IntrusiveList &operator=(const IntrusiveList &) = delete;
+
+    bool empty() const { return _sentinel.next == &_sentinel; }
+    size_t size() const { return _size; }
+
+    /**
+     * @brief 元素当前是否挂在本链表上 (O(1))
+     */
+    bool contains(T *item) const
+    {
+        return item && hook_of(item)->owner == this;
+    }
+
+    /**
+     * @brief 尾部入队；已挂在任意链表上的元素会被拒绝
+     */
+    bool push_back(T *item)
+    {
+        if (!item || hook_of(item)->is_linked())
+            return false;
+        link_between(hook_of(item), _sentinel.prev, &_sentinel);
+        return true;
+    }
+
+    bool push_front(T *item)
+    {
+        if (!item || hook_of(item)->is_linked())
+            return false;
+        link_between(hook_of(item), &_sentinel, _sentinel.next);
+        return true;
+    }
+
+    T *front() const
+    {
+        return empty() ? nullptr : owner_of(_sentinel.next);
+    }
+
+    T *pop_front()
+    {
+        if (empty())
+            return nullptr;
+        IntrusiveListNode *node = _sentinel.next;
+        unlink(node);
+        return owner_of(node);
+    }
+
+    /**
+     * @brief 摘除任意位置的元素 (O(1))，不在本链表上时返回 false
+     */
+    bool remove(T *item)
+    {
+        if (!contains(item))
+            return false;
+        unlink(hook_of(item));
+        return true;
+    }
+
+    template <typename F>
+    void for_each(F func)
+    {
+        IntrusiveListNode *curr = _sentinel.next;
+        while (curr != &_sentinel)
+        {
+            // 先取后继，允许回调中摘除当前元素
+            IntrusiveListNode *next = curr->next;
+            func(owner_of(curr));
+            curr = next;
+        }
+    }
+
+    void clear()
+    {
+        while (pop_front())
+        {
+        }
+    }
+};
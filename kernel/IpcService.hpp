@@ -0,0 +1,358 @@
+#pragma once
+
+#include <atomic>
+
+#include <common/Message.hpp>
+#include <common/diagnostics.hpp>
+
+#include "ITaskLifecycle.hpp"
+#include "TaskScheduler.hpp"
+#include "BufferGrantTable.hpp"
+#include "Notification.hpp"
+#include "FutexTable.hpp"
+#include "IMessageBus.hpp"
+#include "WaitQueue.hpp"
+
+/**
+ * IpcService: 任务间点对点通信
+ * 消息直接写入目标 TCB 内嵌的信箱，不经过总线的队列与订阅表；
+ * 目标若阻塞在 receive 上则被唤醒，更高优先级的接收者在发送方离开临界区时立即得到 CPU
+ *
+ * 同步调用 (call / reply_and_wait) 的参数由任务暂存在 TCB 的 ipc 字段后陷入，
+ * 对端正在等待时经 TaskScheduler::handoff 直接切换，不经过全局消息队列，也不经过就绪队列
+ *
+ * 消息携带缓冲授权 (Message::grant) 时，投递成功即把发送方的一个引用移交给接收方；
+ * 发送方并未持有该授权、或接收方无法再持有时，投递失败且信箱不变
+ *
+ * 通知对象 (Notification) 只传递信号位，等待方经 Wait 陷入阻塞；中断处理中改用 notify_from_irq：
+ * 打断了内核临界区时只置位，唤醒推迟到下一个时钟节拍或分发轮（与 TaskScheduler::on_tick 推迟时间轮相同）
+ * futex 按用户地址等待 / 唤醒，供用户态在竞争时睡眠（见 common/Futex.hpp）
+ * 总线车道已满时 publish_wait 的调用方经 PublishWait 陷入阻塞，由分发者在腾出空间后以 wake_publishers 唤醒
+ *
+ * send / try_receive 的调用方须处于 PreemptGuard 临界区内；on_* 只在陷入门内调用
+ */
+class IpcService
+{
+private:
+    ITaskLifecycle *_lifecycle;
+    TaskScheduler *_scheduler;
+    BufferGrantTable *_grants;         // 可为空：不支持缓冲授权
+    NotificationTable *_notifications; // 可为空：不支持通知对象
+    FutexTable *_futexes;              // 可为空：不支持 futex
+    IMessageBus *_bus = nullptr;       // 可为空：publish_wait 不阻塞
+    WaitQueue _publish_waiters;
+    std::atomic<bool> _notify_deferred{false}; // notify_from_irq 推迟了唤醒，尚未 flush
+
+    uint64_t _sent = 0;
+    uint64_t _rejected = 0;
+    uint64_t _calls = 0;
+
+public:
+    IpcService(ITaskLifecycle *lifecycle, TaskScheduler *scheduler, BufferGrantTable *grants = nullptr,
+               NotificationTable *notifications = nullptr, FutexTable *futexes = nullptr)
+        : _lifecycle(lifecycle), _scheduler(scheduler), _grants(grants), _notifications(notifications), _futexes(futexes) {}
+
+    /**
+     * @return 目标不存在或信箱已满时返回 false，消息被丢弃
+     */
+    bool send(uint32_t task_id, const Message &msg)
+    {
+        ITaskControlBlock *target = deliver(task_id, msg);
+        if (!target)
+            return false;
+
+        if (target->ipc.wait == IpcWait::Receive)
+        {
+            target->ipc.wait = IpcWait::None;
+            _scheduler->wake(target);
+        }
+        return true;
+    }
+
+    /**
+     * @brief 非阻塞地取出当前任务的下一条消息
+     */
+    bool try_receive(Message &out)
+    {
+        ITaskControlBlock *current = _scheduler->get_current();
+        return current && current->mailbox.pop(out);
+    }
+
+    /**
+     * @brief 陷入：信箱仍为空时阻塞当前任务，直到 send / call 投递
+     * 陷入期间中断被屏蔽：此处复查信箱，消息已在途时不阻塞（避免丢失唤醒）
+     */
+    void on_receive()
+    {
+        ITaskControlBlock *current = _scheduler->get_current();
+        if (!current || !current->mailbox.empty())
+            return;
+
+        current->ipc.wait = IpcWait::Receive;
+        if (!_scheduler->block_current())
+            current->ipc.wait = IpcWait::None;
+    }
+
+    /**
+     * @brief 陷入：把 ipc.outgoing 投递给 ipc.partner 并等待回复
+     * 服务端正阻塞在 receive 上时直接移交 CPU；结果写入 ipc.ok
+     */
+    void on_call()
+    {
+        ITaskControlBlock *client = _scheduler->get_current();
+        if (!client)
+            return;
+
+        TaskIpcState &state = client->ipc;
+        state.ok = false;
+
+        ITaskControlBlock *server = state.partner != client->get_id() ? deliver(state.partner, *state.outgoing) : nullptr;
+        if (!server)
+            return;
+
+        _calls++;
+        state.ok = true;
+        state.wait = IpcWait::Reply;
+
+        if (server->ipc.wait == IpcWait::Receive)
+        {
+            server->ipc.wait = IpcWait::None;
+            if (_scheduler->handoff(server))
+                return; // 回到这里时回复已写入 reply_buf
+
+            _scheduler->wake(server);
+        }
+
+        if (!_scheduler->block_current())
+        {
+            K_WARN("IPC: [%s] cannot wait for reply", client->get_name());
+            state.wait = IpcWait::None;
+            state.ok = false;
+        }
+    }
+
+    /**
+     * @brief 陷入：把 ipc.outgoing 写入 ipc.partner 的回复缓冲，然后等待下一条请求
+     * 信箱为空时直接把 CPU 交还给客户端；ipc.ok 表示回复是否送达
+     * 回复无法送达（授权不可移交）时，正在等待的客户端带着 ipc.ok == false 返回，不会永远阻塞
+     */
+    void on_reply()
+    {
+        ITaskControlBlock *server = _scheduler->get_current();
+        if (!server)
+            return;
+
+        TaskIpcState &state = server->ipc;
+        ITaskControlBlock *client = _lifecycle->get_task(state.partner);
+        bool waiting = client && client->ipc.wait == IpcWait::Reply && client->ipc.partner == server->get_id();
+        state.ok = waiting && can_move_grant(*state.outgoing, server->get_id(), client->get_id());
+
+        if (state.ok)
+        {
+            move_grant(*state.outgoing, server->get_id(), client->get_id());
+            *client->ipc.reply_buf = *state.outgoing;
+            client->ipc.reply_buf->sender = server->get_id();
+        }
+        else if (waiting)
+        {
+            client->ipc.ok = false;
+        }
+        if (waiting)
+            client->ipc.wait = IpcWait::None;
+
+        if (!server->mailbox.empty())
+        {
+            // 还有积压的请求：服务端继续处理，客户端按常规路径就绪
+            if (waiting)
+                _scheduler->wake(client);
+            if (_scheduler->resched_pending())
+                _scheduler->yield_current();
+            return;
+        }
+
+        server->ipc.wait = IpcWait::Receive;
+        if (waiting && _scheduler->handoff(client))
+            return;
+
+        if (waiting)
+            _scheduler->wake(client);
+        if (!_scheduler->block_current())
+            server->ipc.wait = IpcWait::None;
+    }
+
+    /**
+     * @brief 置位并唤醒等待者；调用方须处于 PreemptGuard 临界区或陷入门内
+     * @return 句柄无效时返回 false
+     */
+    bool notify(uint32_t handle, uint64_t bits)
+    {
+        Notification *n = notification(handle);
+        if (!n)
+            return false;
+
+        n->signal(*_scheduler, bits);
+        return true;
+    }
+
+    /**
+     * @brief 中断处理中置位：打断了内核临界区时只置位，唤醒留给 flush_deferred_notifications
+     * @return 句柄无效时返回 false
+     */
+    bool notify_from_irq(uint32_t handle, uint64_t bits)
+    {
+        Notification *n = notification(handle);
+        if (!n)
+            return false;
+
+        if (_scheduler->is_preemptible())
+        {
+            n->signal(*_scheduler, bits);
+            return true;
+        }
+
+        n->signal_deferred(bits);
+        _notify_deferred.store(true, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 补做 notify_from_irq 推迟的唤醒；在时钟节拍与空闲循环的分发轮中调用
+     * 调用方须处于自己的 PreemptGuard 临界区内，或是没有打断临界区的中断处理
+     * @return 唤醒的任务数
+     */
+    uint32_t flush_deferred_notifications()
+    {
+        if (!_notifications || !_notify_deferred.exchange(false, std::memory_order_acq_rel))
+            return 0;
+        return _notifications->flush_deferred(*_scheduler);
+    }
+
+    /**
+     * @brief 陷入：等待 ipc.partner 指定的通知对象，取走的位写入 ipc.bits
+     * 陷入期间中断被屏蔽：复查待处理位，已有信号时不阻塞（避免丢失唤醒）
+     */
+    void on_wait()
+    {
+        ITaskControlBlock *current = _scheduler->get_current();
+        if (!current)
+            return;
+
+        Notification *n = notification(current->ipc.partner);
+        if (!n)
+        {
+            current->ipc.bits = 0;
+            return;
+        }
+        n->wait(*_scheduler);
+    }
+
+    /**
+     * @brief 陷入：ipc.futex_addr 上的值仍为 ipc.futex_expected 时睡眠；wake_at_ms 非零时限时
+     * 结果写入 ipc.ok：被 futex_wake 唤醒为 true；值已改变或超时为 false（超时另置 wait_timed_out）
+     */
+    void on_futex_wait()
+    {
+        ITaskControlBlock *current = _scheduler->get_current();
+        if (!current)
+            return;
+
+        TaskIpcState &state = current->ipc;
+        const volatile uint32_t *addr = state.futex_addr;
+        state.ok = false;
+        current->wait_timed_out = false;
+        if (_futexes && _futexes->wait(*_scheduler, addr, state.futex_expected, current->wake_at_ms))
+            state.ok = !current->wait_timed_out;
+    }
+
+    /**
+     * @return 唤醒的任务数
+     */
+    uint32_t futex_wake(const volatile uint32_t *addr, uint32_t count)
+    {
+        return _futexes ? _futexes->wake(*_scheduler, addr, count) : 0;
+    }
+
+    /**
+     * @brief 陷入：ipc.partner 指定类型的车道仍然满时阻塞，直到 wake_publishers
+     * 结果写入 ipc.ok：阻塞后被唤醒为 true；车道已有空间或无法阻塞为 false，调用方都应重试投递
+     */
+    void on_publish_wait()
+    {
+        ITaskControlBlock *current = _scheduler->get_current();
+        if (!current)
+            return;
+
+        MessageType type = static_cast<MessageType>(current->ipc.partner);
+        current->ipc.ok = false;
+        if (_bus && !_bus->has_room(type))
+            current->ipc.ok = _scheduler->block_on(_publish_waiters);
+    }
+
+    /**
+     * @brief 分发者在一轮分发之后调用：唤醒所有因车道已满而阻塞的投递者，由它们各自重试
+     * 调用方须处于 PreemptGuard 临界区内
+     * @return 唤醒的任务数
+     */
+    size_t wake_publishers()
+    {
+        return _publish_waiters.empty() ? 0 : _scheduler->wake_all(_publish_waiters);
+    }
+
+    void set_bus(IMessageBus *bus) { _bus = bus; }
+
+    uint64_t sent_count() const { return _sent; }
+    uint64_t rejected_count() const { return _rejected; }
+    uint64_t call_count() const { return _calls; }
+
+    BufferGrantTable *grants() const { return _grants; }
+    NotificationTable *notifications() const { return _notifications; }
+    FutexTable *futexes() const { return _futexes; }
+
+private:
+    Notification *notification(uint32_t handle) const
+    {
+        return _notifications ? _notifications->get(handle) : nullptr;
+    }
+
+    /**
+     * @brief 写入目标信箱并标注发送方
+     */
+    ITaskControlBlock *deliver(uint32_t task_id, const Message &msg)
+    {
+        ITaskControlBlock *target = _lifecycle->get_task(task_id);
+
+        Message stamped = msg;
+        ITaskControlBlock *current = _scheduler->get_current();
+        stamped.sender = current ? current->get_id() : KERNEL_TASK_ID;
+
+        if (!target || !can_move_grant(stamped, stamped.sender, task_id) || !target->mailbox.push(stamped))
+        {
+            _rejected++;
+            return nullptr;
+        }
+
+        move_grant(stamped, stamped.sender, task_id);
+        _sent++;
+        return target;
+    }
+
+    /**
+     * @brief 随消息移交缓冲授权前的检查：先确认可以移交，再提交其他副作用
+     */
+    bool can_move_grant(const Message &msg, uint32_t from, uint32_t to)
+    {
+        if (!msg.grant)
+            return true;
+        return _grants && _grants->can_transfer(msg.grant, from, to);
+    }
+
+    /**
+     * @brief 随消息移交缓冲授权；不带授权的消息总是成功
+     */
+    bool move_grant(const Message &msg, uint32_t from, uint32_t to)
+    {
+        if (!msg.grant)
+            return true;
+        return _grants && _grants->transfer(msg.grant, from, to);
+    }
+};
@@ -5,6 +5,8 @@
 template <typename T>
 struct ListNode
 {
+    static constexpr bool SLAB_CACHED = true; // 链表节点是最频繁的小对象
+
     T data;
     ListNode *next;
 
@@ -14,9 +14,15 @@ private:
     FreeNode *_free_list = nullptr;
     IObjectBuilder *_builder;
     size_t _object_size;
+    size_t _max_objects; // 向 builder 申请的对象总数上限，0 表示不限
+    size_t _created = 0;
 
 public:
-    KObjectPool(IObjectBuilder *b) : _builder(b)
+    /**
+     * @param max_objects 池的容量上限：空闲链为空且已达上限时 acquire 返回 nullptr，
+     *                    而不是继续向 builder 申请，避免突发流量耗尽内核堆
+     */
+    KObjectPool(IObjectBuilder *b, size_t max_objects = 0) : _builder(b), _max_objects(max_objects)
     {
         _object_size = sizeof(T) > sizeof(FreeNode) ? sizeof(T) : sizeof(FreeNode);
         _object_size = (_object_size + 15ULL) & ~15ULL; // 保持 16 字节对齐
@@ -35,11 +41,19 @@ public:
             return new (ptr) T(std::forward<Args>(args)...);
         }
 
+        if (_max_objects && _created >= _max_objects)
+            return nullptr;
+
         // 池子里没了，找 builder 真的生一个出来
         // 这样 builder 还能继续追踪这个对象的来源
-        return _builder->construct<T>(std::forward<Args>(args)...);
+        ptr = _builder->construct<T>(std::forward<Args>(args)...);
+        if (ptr)
+            _created++;
+        return ptr;
     }
 
+    size_t created_count() const { return _created; }
+
     void release(T *ptr)
     {
         if (!ptr)
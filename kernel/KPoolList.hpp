@@ -27,12 +27,15 @@ public:
         clear();
     }
 
-    void push_back(const T &data)
+    /**
+     * @return 池已达上限或内存耗尽时返回 false，元素未加入
+     */
+    bool push_back(const T &data)
     {
         // 1. 从池中获取一个裸内存节点
         ListNode<T> *node = _pool.acquire(data);
         if (!node)
-            return;
+            return false;
 
         if (!_head)
         {
@@ -45,6 +48,7 @@ public:
         }
 
         _size++;
+        return true;
     }
 
     /**
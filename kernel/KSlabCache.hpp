@@ -0,0 +1,340 @@
+#pragma once
+
+#include "IAllocator.hpp"
+#include "KernelUtils.hpp"
+
+/**
+ * KSlabCache: 单一类型对象的 slab 缓存
+ * - 每个 slab 是一段按自身尺寸对齐的连续内存，头部为 Slab 描述符，其后紧密排列对象
+ * - 对象指针按 slab 尺寸向下取整即得到所属 slab，释放时无需任何对象头
+ * - slab 分 partial / full / empty 三种状态：partial 与 empty 各一条链表；
+ *   full slab 只计数不入链（没有任何路径需要遍历它们，入链只会在每次状态切换时额外触碰相邻 slab 的缓存行）
+ * - 空 slab 只保留一个热备，其余立即归还堆（唯一的 partial slab 变空时留在原处作为当前分配 slab）
+ *
+ * 要求后备分配器遵守 alignment 参数（如 TlsfHeapAllocator）
+ */
+class KSlabCache
+{
+public:
+    static const size_t SLAB_SIZE_MIN = 1024;
+    static const size_t OBJECTS_PER_SLAB_MIN = 8;
+    static const size_t EMPTY_SLABS_KEPT = 1;
+
+private:
+    struct Slab
+    {
+        Slab *prev;
+        Slab *next;
+        void *free_list; // slab 内空闲对象的单链表（链接指针写在对象内存里）
+        uint32_t in_use;
+        uint32_t capacity;
+    };
+
+    struct FreeObject
+    {
+        FreeObject *next;
+    };
+
+    IAllocator *_backing = nullptr;
+    const void *_type_key = nullptr;
+
+    size_t _object_size = 0;
+    size_t _first_offset = 0; // 第一个对象相对 slab 起点的偏移
+    size_t _slab_size = 0;
+    uint32_t _capacity = 0;
+
+    Slab *_partial = nullptr;
+    Slab *_empty = nullptr;
+    size_t _full_count = 0;
+    size_t _empty_count = 0;
+    size_t _slab_count = 0;
+
+public:
+    KSlabCache() = default;
+
+    /**
+     * @param backing 提供 slab 内存的堆
+     * @param type_key 类型标识（仅用于缓存表查找）
+     */
+    void init(IAllocator *backing, const void *type_key, size_t object_size, size_t alignment)
+    {
+        if (alignment < sizeof(void *))
+            alignment = sizeof(void *);
+
+        _backing = backing;
+        _type_key = type_key;
+        _object_size = KernelUtils::Align::up(object_size < sizeof(FreeObject) ? sizeof(FreeObject) : object_size, alignment);
+        _first_offset = KernelUtils::Align::up(sizeof(Slab), alignment);
+
+        // slab 尺寸取 2 的幂，至少容纳 OBJECTS_PER_SLAB_MIN 个对象
+        size_t needed = _first_offset + _object_size * OBJECTS_PER_SLAB_MIN;
+        _slab_size = SLAB_SIZE_MIN;
+        while (_slab_size < needed)
+            _slab_size <<= 1;
+
+        _capacity = static_cast<uint32_t>((_slab_size - _first_offset) / _object_size);
+    }
+
+    bool is_initialized() const { return _backing != nullptr; }
+    const void *type_key() const { return _type_key; }
+
+    size_t object_size() const { return _object_size; }
+    size_t slab_size() const { return _slab_size; }
+    size_t slab_count() const { return _slab_count; }
+    size_t full_slab_count() const { return _full_count; }
+    size_t empty_slab_count() const { return _empty_count; }
+
+    void *allocate()
+    {
+        Slab *slab = _partial;
+        if (!slab)
+        {
+            if (_empty)
+            {
+                slab = _empty;
+                unlink(_empty, slab);
+                _empty_count--;
+            }
+            else
+            {
+                slab = grow();
+                if (!slab)
+                    return nullptr;
+            }
+            push(_partial, slab);
+        }
+
+        FreeObject *obj = static_cast<FreeObject *>(slab->free_list);
+        slab->free_list = obj->next;
+        slab->in_use++;
+
+        if (slab->in_use == slab->capacity)
+        {
+            // 当前 slab 必为 partial 链表头，直接摘下
+            unlink(_partial, slab);
+            _full_count++;
+        }
+
+        return obj;
+    }
+
+    void deallocate(void *ptr)
+    {
+        if (!ptr)
+            return;
+
+        Slab *slab = slab_of(ptr);
+        bool was_full = slab->in_use == slab->capacity;
+
+        FreeObject *obj = static_cast<FreeObject *>(ptr);
+        obj->next = static_cast<FreeObject *>(slab->free_list);
+        slab->free_list = obj;
+        slab->in_use--;
+
+        if (was_full)
+        {
+            push(_partial, slab);
+            _full_count--;
+        }
+
+        // 唯一的 partial slab 变空时原地保留，避免单对象反复分配/释放时在链表间来回搬移
+        if (slab->in_use == 0 && !(slab == _partial && !slab->next))
+        {
+            unlink(_partial, slab);
+            if (_empty_count < EMPTY_SLABS_KEPT)
+            {
+                push(_empty, slab);
+                _empty_count++;
+            }
+            else
+            {
+                release(slab);
+            }
+        }
+    }
+
+    /**
+     * @brief 将所有空 slab 归还给后备堆
+     * @return 归还的 slab 数量
+     */
+    size_t reclaim()
+    {
+        size_t count = 0;
+
+        // 保留在 partial 链表中的空 slab 也一并归还
+        if (_partial && _partial->in_use == 0 && !_partial->next)
+        {
+            Slab *slab = _partial;
+            unlink(_partial, slab);
+            release(slab);
+            count++;
+        }
+
+        while (_empty)
+        {
+            Slab *slab = _empty;
+            unlink(_empty, slab);
+            release(slab);
+            count++;
+        }
+        _empty_count = 0;
+        return count;
+    }
+
+private:
+    Slab *slab_of(void *ptr) const
+    {
+        return reinterpret_cast<Slab *>(KernelUtils::Align::down(reinterpret_cast<uintptr_t>(ptr), _slab_size));
+    }
+
+    Slab *grow()
+    {
+        void *mem = _backing->allocate(_slab_size, _slab_size);
+        if (!mem)
+            return nullptr;
+
+        // 后备堆未满足对齐要求时无法通过地址反查 slab，直接放弃
+        if (!KernelUtils::Align::is_aligned(reinterpret_cast<uintptr_t>(mem), _slab_size))
+        {
+            _backing->deallocate(mem, _slab_size);
+            return nullptr;
+        }
+
+        Slab *slab = static_cast<Slab *>(mem);
+        slab->prev = nullptr;
+        slab->next = nullptr;
+        slab->in_use = 0;
+        slab->capacity = _capacity;
+
+        // 串起 slab 内的空闲对象（按地址递增顺序分配）
+        uint8_t *base = static_cast<uint8_t *>(mem) + _first_offset;
+        FreeObject *head = nullptr;
+        for (uint32_t i = _capacity; i > 0; --i)
+        {
+            FreeObject *obj = reinterpret_cast<FreeObject *>(base + (i - 1) * _object_size);
+            obj->next = head;
+            head = obj;
+        }
+        slab->free_list = head;
+
+        _slab_count++;
+        return slab;
+    }
+
+    void release(Slab *slab)
+    {
+        _backing->deallocate(slab, _slab_size);
+        _slab_count--;
+    }
+
+    static void push(Slab *&head, Slab *slab)
+    {
+        slab->prev = nullptr;
+        slab->next = head;
+        if (head)
+            head->prev = slab;
+        head = slab;
+    }
+
+    static void unlink(Slab *&head, Slab *slab)
+    {
+        if (slab->prev)
+            slab->prev->next = slab->next;
+        else
+            head = slab->next;
+        if (slab->next)
+            slab->next->prev = slab->prev;
+        slab->prev = slab->next = nullptr;
+    }
+};
+
+/**
+ * KSlabCacheTable: 按类型索引的 slab 缓存集合
+ * 以类型标识地址为键做开放寻址，首次构造某类型时惰性建立其缓存
+ */
+class KSlabCacheTable
+{
+public:
+    static const size_t MAX_CACHES = 32;
+
+    // 超过该尺寸的对象直接走堆：大对象无法在 slab 中紧密排列
+    static const size_t MAX_OBJECT_SIZE = 512;
+
+private:
+    IAllocator *_backing;
+    KSlabCache _caches[MAX_CACHES];
+
+public:
+    explicit KSlabCacheTable(IAllocator *backing) : _backing(backing) {}
+
+    /**
+     * @brief 查找或建立类型对应的缓存
+     * @return 不适合 slab 化（尺寸过大或表已满）时返回 nullptr，调用方应回退到堆
+     */
+    KSlabCache *cache_for(const void *type_key, size_t size, size_t alignment)
+    {
+        if (size > MAX_OBJECT_SIZE)
+            return nullptr;
+
+        size_t index = hash(type_key);
+        for (size_t probe = 0; probe < MAX_CACHES; ++probe)
+        {
+            KSlabCache &cache = _caches[(index + probe) % MAX_CACHES];
+            if (cache.type_key() == type_key)
+                return &cache;
+
+            if (!cache.is_initialized())
+            {
+                cache.init(_backing, type_key, size, alignment);
+                return &cache;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief 仅查找已建立的缓存（释放路径使用）
+     */
+    KSlabCache *find(const void *type_key)
+    {
+        size_t index = hash(type_key);
+        for (size_t probe = 0; probe < MAX_CACHES; ++probe)
+        {
+            KSlabCache &cache = _caches[(index + probe) % MAX_CACHES];
+            if (cache.type_key() == type_key)
+                return &cache;
+            if (!cache.is_initialized())
+                return nullptr;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief 回收所有缓存中的空 slab（内存紧张时调用）
+     */
+    size_t reclaim()
+    {
+        size_t count = 0;
+        for (auto &cache : _caches)
+            count += cache.reclaim();
+        return count;
+    }
+
+    template <typename F>
+    void for_each_cache(F f) const
+    {
+        for (const auto &cache : _caches)
+        {
+            if (cache.is_initialized())
+                f(cache);
+        }
+    }
+
+private:
+    static size_t hash(const void *key)
+    {
+        uint64_t v = reinterpret_cast<uintptr_t>(key);
+        v *= 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(v >> 58) % MAX_CACHES;
+    }
+};
@@ -6,6 +6,8 @@
 class KStackBuffer : public KResource<uint8_t>
 {
 public:
+    static constexpr bool SLAB_CACHED = true; // 仅描述符走 slab，栈内存本身仍来自堆
+
     // 继承构造函数
     using KResource<uint8_t>::KResource;
 
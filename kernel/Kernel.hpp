@@ -20,8 +20,11 @@
 #include "KStackBuffer.hpp"
 #include "ISchedulingControl.hpp"
 #include "KernelHeapAllocator.hpp"
+#include "TlsfHeapAllocator.hpp"
 
 #include "RoundRobinStrategy.hpp"
+#include "PriorityStrategy.hpp"
+#include "PrioritySchedulingPolicy.hpp"
 #include "SimpleTaskLifecycle.hpp"
 #include "KernelObjectBuilder.hpp"
 #include "MessageBus.hpp"
@@ -31,12 +34,26 @@
 #include "SignalType.hpp"
 
 #include "KernelProxy.hpp"
+#include "IpcService.hpp"
 #include "SignalDispatcher.hpp"
 
 #include "TaskScheduler.hpp"
 
 const size_t MIN_STACK_SIZE = 16 * 1024;
 
+// 时钟中断周期：时间片记账的最小粒度
+const uint32_t KERNEL_TICK_MS = 10;
+
+// 缓冲授权专用池：容纳整帧显存大小的缓冲区；运行时堆不足时不提供缓冲授权
+const size_t GRANT_POOL_SIZE = 4 * 1024 * 1024;
+
+// 空闲循环每轮分发的消息数 / 时间上限：超出部分留到下一轮，期间就绪任务与时钟节拍先得到 CPU
+const uint32_t BUS_DISPATCH_BUDGET = 64;
+const uint32_t BUS_DISPATCH_BUDGET_US = 1000;
+
+// 运行时堆的默认实现：TLSF (O(1) 分配/释放)；可切换回 KernelHeapAllocator (首次适配)
+typedef TlsfHeapAllocator RuntimeHeapAllocator;
+
 /**
  * @brief 任务档案：存储任务的静态元数据，不随任务状态改变
  */
@@ -57,6 +74,7 @@ private:
     // 基础依赖
     StaticLayoutAllocator *_static_allocator; // 初始静态分配器
     IAllocator *_runtime_heap;                // 稍后建立的动态堆
+    KSlabCacheTable *_slab_caches = nullptr;  // 固定尺寸内核对象的 slab 缓存
     IObjectBuilder *_builder;                 // 稍后建立的业务构建器
 
     ITaskControlBlockFactory *_tcb_factory;
@@ -66,6 +84,7 @@ private:
     IMessageBus *_bus;
     ITaskLifecycle *_lifecycle;
     ISchedulingStrategy *_strategy;
+    ISchedulingPolicy *_policy = nullptr;
 
     BootInfo &_boot_info;
     IUserRuntime *_user_runtime = nullptr;
@@ -75,9 +94,15 @@ private:
     PlatformHooks *_platform_hooks = nullptr;
 
     ITaskControlBlock *_idle_tcb = nullptr;
+    // 空闲循环已准备入睡：只有此时总线投递才需要唤醒平台
+    volatile bool _idle_waiting = false;
 
     SignalDispatcher *_signal_dispatcher = nullptr;
     TaskScheduler *_task_scheduler = nullptr;
+    IpcService *_ipc = nullptr;
+    BufferGrantTable *_grants = nullptr;
+    NotificationTable *_notifications = nullptr;
+    FutexTable *_futexes = nullptr;
 
 public:
     // 构造函数：注入 Builder 和 CPU 引擎
@@ -114,28 +139,50 @@ public:
 
         _runtime_heap = create_runtime_heap(heap_size);
 
-        // 2. 建立业务构建器 (从静态分配器中划拨 Builder 所需空间)
+        // 2. 建立对象缓存表：TCB、链表节点等固定尺寸对象从各自的 slab 分配
+        void *slab_mem = _static_allocator->allocate(sizeof(KSlabCacheTable), alignof(KSlabCacheTable));
+        _slab_caches = new (slab_mem) KSlabCacheTable(_runtime_heap);
+
+        // 3. 建立业务构建器 (从静态分配器中划拨 Builder 所需空间)
         void *builder_mem = _static_allocator->allocate(sizeof(KernelObjectBuilder));
         // Builder 将使用刚刚建立的 _runtime_heap 作为其分配源
-        _builder = new (builder_mem) KernelObjectBuilder(_runtime_heap);
+        _builder = new (builder_mem) KernelObjectBuilder(_runtime_heap, _slab_caches);
 
         // 所有的组件现在都统一收纳在 Kernel 内部
-        _bus = _builder->construct<MessageBus>(_builder);
+        auto *bus = _builder->construct<MessageBus>(_builder);
+        bus->set_wakeup_handler(&Kernel::on_bus_wakeup, this);
+        // 内核订阅者按类型相互独立：按类型分组分发，输入/渲染突发时每批每类型只查一次表
+        bus->set_dispatch_mode(MessageBus::DispatchMode::GroupedByType);
+        // 分发预算：积压再多，空闲循环每轮也只处理有限的消息，之后回到调度器
+        bus->set_clock(_platform_hooks->monotonic_us);
+        bus->set_dispatch_budget(BUS_DISPATCH_BUDGET, BUS_DISPATCH_BUDGET_US);
+        _bus = bus;
+
+        // 显存刷新请求在入队时合并脏矩形：连续绘制在一个分发周期内只刷新一次
+        bus->set_coalescing(MessageType::EVENT_VRAM_UPDATED, &Kernel::merge_dirty_rect);
 
         _bus->subscribe(MessageType::EVENT_PRINT, BIND_MESSAGE_CB(Kernel, handle_event_print, this));
+        _bus->subscribe_channel<VramUpdatedChannel, Kernel, &Kernel::handle_vram_updated>(this);
 
         auto id_gen = _builder->construct<BitmapIdGenerator<64>>();
         // 注入 builder 即可，Factory 内部需要资源时，Kernel 会提供辅助
         _tcb_factory = _builder->construct<SimpleTaskFactory>(_builder, _platform_hooks->task_context_factory, id_gen);
 
-        _strategy = _builder->construct<RoundRobinStrategy>(_builder);
+        _strategy = _builder->construct<PriorityStrategy>();
         _lifecycle = _builder->construct<SimpleTaskLifecycle>(_builder, _tcb_factory);
 
-        _task_scheduler = _builder->construct<TaskScheduler>(_strategy, nullptr);
-        _signal_dispatcher = _builder->construct<SignalDispatcher>(*_task_scheduler);
+        _policy = _builder->construct<PrioritySchedulingPolicy>();
+        _task_scheduler = _builder->construct<TaskScheduler>(_strategy, _policy);
+        _grants = create_grant_table(GRANT_POOL_SIZE);
+        _notifications = _builder->construct<NotificationTable>();
+        _futexes = _builder->construct<FutexTable>();
+        _ipc = _builder->construct<IpcService>(_lifecycle, _task_scheduler, _grants, _notifications, _futexes);
+        _ipc->set_bus(bus);
+        bus->set_grant_table(_grants);
+        _signal_dispatcher = _builder->construct<SignalDispatcher>(*_task_scheduler, KERNEL_TICK_MS, _ipc);
 
         // 组装 Service
-        _task_service = _builder->construct<TaskService>(_lifecycle, _strategy, _bus);
+        _task_service = _builder->construct<TaskService>(_lifecycle, _strategy, _bus, _task_scheduler, _grants);
 
         _task_archives = _builder->construct<KList<TaskArchive>>(_builder);
     }
@@ -180,6 +227,10 @@ public:
         // 在 Mock 上：这对应启动模拟器的时序产生逻辑
         _platform_hooks->dispatcher->activate();
 
+        // 启动时钟中断：从此任务不再依赖主动 yield 才能被切走
+        if (_platform_hooks->start_timer)
+            _platform_hooks->start_timer(KERNEL_TICK_MS);
+
         // 4. 执行物理跳转（不归路）
         // 从 RootTask 的 Archive 中提取初始上下文（SP, PC, Registers）并覆盖当前 CPU 状态
         // 此行代码执行后，CPU 将跳转到 RootTask 的入口点执行
@@ -192,10 +243,16 @@ public:
         K_INFO("Kernel Engine: Idle flow resumed.");
         while (true)
         {
-            _bus->dispatch_messages();
-
-            if (_platform_hooks && _platform_hooks->halt)
-                _platform_hooks->halt();
+            {
+                // 空闲循环在中断开启时分发消息，必须处于临界区内；腾出空间后唤醒阻塞的投递者，
+                // 并补做中断推迟的通知唤醒
+                PreemptGuard guard(_task_scheduler, _platform_hooks->sched_control);
+                _bus->dispatch_messages();
+                _ipc->wake_publishers();
+                _ipc->flush_deferred_notifications();
+            }
+
+            idle_wait();
         }
 
         // --- 逻辑真空区 ---
@@ -217,11 +274,71 @@ public:
     }
 
 private:
+    /**
+     * @brief 空闲等待
+     * 有其他就绪任务时立即让出；否则停掉时钟 (tickless) 并阻塞，
+     * 直到总线投递或外部中断唤醒，系统完全空闲时不产生任何唤醒；有任务在睡眠时时钟保持运行
+     */
+    void idle_wait()
+    {
+        ISchedulingControl *ctrl = _platform_hooks->sched_control;
+
+        bool has_ready;
+        {
+            PreemptGuard guard(_task_scheduler, ctrl);
+            has_ready = _strategy->peek_next_ready_task() != nullptr;
+            _idle_waiting = !has_ready;
+        }
+
+        if (has_ready)
+        {
+            // 中断可能让任务就绪：立即让出，而不是等下一个节拍
+            if (ctrl)
+                ctrl->yield_current_task();
+            return;
+        }
+
+        // 上一轮因预算用完而留下积压：继续分发，不进入等待
+        if (_bus->has_pending())
+        {
+            _idle_waiting = false;
+            return;
+        }
+
+        if (!_platform_hooks->wait_for_event)
+        {
+            _idle_waiting = false;
+            if (_platform_hooks->halt)
+                _platform_hooks->halt();
+            return;
+        }
+
+        // 有任务在睡眠时保留时钟：节拍推进时间轮，到期的中断同时结束空闲等待
+        bool keep_tick = _task_scheduler->has_sleepers();
+        if (!keep_tick && _platform_hooks->stop_timer)
+            _platform_hooks->stop_timer();
+
+        // 复查：置位 _idle_waiting 之前投递的消息不会触发通知
+        if (!_bus->has_pending())
+            _platform_hooks->wait_for_event(0);
+        _idle_waiting = false;
+
+        if (!keep_tick && _platform_hooks->start_timer)
+            _platform_hooks->start_timer(KERNEL_TICK_MS);
+    }
+
+    static void on_bus_wakeup(void *context)
+    {
+        Kernel *kernel = static_cast<Kernel *>(context);
+        if (kernel->_idle_waiting && kernel->_platform_hooks->notify_event)
+            kernel->_platform_hooks->notify_event();
+    }
+
     ITaskControlBlock *create_kernel_task(TaskEntry entry, TaskPriority priority, size_t stack_size, void *config = nullptr, const char *name = "k_service_unamed")
     {
         TaskExecutionInfo exec{};
         exec.entry = entry;
-        exec.runtime = _builder->construct<KernelRuntimeProxy>(_bus, _platform_hooks);
+        exec.runtime = _builder->construct<KernelRuntimeProxy>(_bus, _platform_hooks, _task_scheduler, _ipc);
         exec.config = config;
 
         TaskResourceConfig res{};
@@ -251,6 +368,17 @@ private:
         K_DEBUG("Received Message Type: %d\n", static_cast<int>(msg.type));
     }
 
+    void handle_vram_updated(const DirtyRect &dirty)
+    {
+        if (_platform_hooks->refresh_display)
+            _platform_hooks->refresh_display(dirty);
+    }
+
+    static void merge_dirty_rect(Message &pending, const Message &incoming)
+    {
+        pending = VramUpdatedChannel::make(VramUpdatedChannel::read(pending).unite(VramUpdatedChannel::read(incoming)));
+    }
+
     /**
      * @brief 策略方法：根据当前可用内存决定堆的大小
      */
@@ -265,23 +393,43 @@ private:
         return (preferred_size < safe_limit) ? preferred_size : safe_limit;
     }
 
+    /**
+     * @brief 从运行时堆划出缓冲授权的专用池
+     */
+    BufferGrantTable *create_grant_table(size_t pool_size)
+    {
+        void *pool = _runtime_heap->allocate(pool_size, 64);
+        if (!pool)
+        {
+            K_WARN("Kernel: no room for a %zu byte grant pool, buffer grants disabled", pool_size);
+            return nullptr;
+        }
+
+        auto *grants = _builder->construct<BufferGrantTable>(pool, pool_size);
+        if (!grants)
+            _runtime_heap->deallocate(pool, pool_size);
+        return grants;
+    }
+
     /**
      * @brief 装配方法：执行具体的内存切分和堆对象构造
+     * @tparam HeapAllocator 堆实现，需提供 (void *start, size_t size) 构造函数
      */
+    template <typename HeapAllocator = RuntimeHeapAllocator>
     IAllocator *create_runtime_heap(size_t size)
     {
-        if (size <= sizeof(KernelHeapAllocator))
+        if (size <= sizeof(HeapAllocator))
             return nullptr;
 
-        void *heap_mem = _static_allocator->allocate(size);
+        void *heap_mem = _static_allocator->allocate(size, alignof(HeapAllocator));
         if (!heap_mem)
             return nullptr;
 
         // 计算管理边界：跳过管理器对象本身占用的空间
-        void *actual_managed_start = (uint8_t *)heap_mem + sizeof(KernelHeapAllocator);
-        size_t actual_managed_size = size - sizeof(KernelHeapAllocator);
+        void *actual_managed_start = (uint8_t *)heap_mem + sizeof(HeapAllocator);
+        size_t actual_managed_size = size - sizeof(HeapAllocator);
 
         // 就地构造堆管理器
-        return new (heap_mem) KernelHeapAllocator(actual_managed_start, actual_managed_size);
+        return new (heap_mem) HeapAllocator(actual_managed_start, actual_managed_size);
     }
 };
\ No newline at end of file
@@ -5,8 +5,10 @@
 class KernelHeapAllocator : public IAllocator
 {
 private:
+    template <typename>
     friend class HeapInspector;
-    struct HeapBlock
+    // Header 按 16 字节对齐，保证其后的有效载荷满足 alignas(16) 类型（如 Message）
+    struct alignas(16) HeapBlock
     {
         size_t size;
         bool is_used;
@@ -26,9 +28,10 @@ public:
         : _heap_start(start), _heap_size(size)
     {
 
-        // 初始化第一个大空闲块
-        _first_block = reinterpret_cast<HeapBlock *>(start);
-        _first_block->size = size;
+        // 初始化第一个大空闲块（起始地址向上对齐到 Header 的对齐要求）
+        uintptr_t aligned = KernelUtils::Align::up(reinterpret_cast<uintptr_t>(start), alignof(HeapBlock));
+        _first_block = reinterpret_cast<HeapBlock *>(aligned);
+        _first_block->size = KernelUtils::Align::down(size - (aligned - reinterpret_cast<uintptr_t>(start)), alignof(HeapBlock));
         _first_block->is_used = false;
         _first_block->next = nullptr;
     }
@@ -36,6 +39,9 @@ public:
     void *allocate(size_t size, size_t alignment = 8) override
     {
         // 1. 计算实际需要的尺寸：请求大小 + Header 大小，并对齐
+        // 块尺寸至少按 Header 对齐取整，使切分出的下一个块仍然对齐
+        if (alignment < alignof(HeapBlock))
+            alignment = alignof(HeapBlock);
         size_t total_needed = KernelUtils::Align::up(size + sizeof(HeapBlock), alignment);
 
         HeapBlock *curr = _first_block;
@@ -96,4 +102,15 @@ public:
             }
         }
     }
+
+private:
+    /**
+     * 按物理顺序遍历所有块，f 形如 void(size_t size, bool used)
+     */
+    template <typename F>
+    void for_each_block(F f) const
+    {
+        for (HeapBlock *curr = _first_block; curr; curr = curr->next)
+            f(curr->size, curr->is_used);
+    }
 };
\ No newline at end of file
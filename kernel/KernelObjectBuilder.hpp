@@ -1,18 +1,21 @@
 #pragma once
 
 #include "IObjectBuilder.hpp"
+#include "KSlabCache.hpp"
 
 /**
  * KernelObjectBuilder: 负责在内核空间构建对象
+ * 注入 KSlabCacheTable 后，声明了 SLAB_CACHED 的类型从各自的 slab 缓存分配
  */
 class KernelObjectBuilder : public IObjectBuilder
 {
 private:
     size_t _active_objects = 0; // 内核存活对象计数
+    KSlabCacheTable *_slab_caches = nullptr;
 
 public:
-    KernelObjectBuilder(IAllocator *alloc)
-        : IObjectBuilder(alloc)
+    KernelObjectBuilder(IAllocator *alloc, KSlabCacheTable *slab_caches = nullptr)
+        : IObjectBuilder(alloc), _slab_caches(slab_caches)
     {
     }
 
@@ -35,4 +38,29 @@ public:
             _active_objects--; // 销毁时减一
         }
     }
-};
\ No newline at end of file
+
+    KSlabCacheTable *slab_caches() const { return _slab_caches; }
+
+protected:
+    void *allocate_cached(const void *type_key, size_t size, size_t alignment) override
+    {
+        // 缓存表对某类型的决策是固定的：要么始终走 slab，要么始终走堆，释放时据此对称处理
+        KSlabCache *cache = _slab_caches ? _slab_caches->cache_for(type_key, size, alignment) : nullptr;
+        if (!cache)
+            return IObjectBuilder::allocate_cached(type_key, size, alignment);
+
+        return cache->allocate();
+    }
+
+    void release_cached(const void *type_key, void *ptr, size_t size) override
+    {
+        KSlabCache *cache = _slab_caches ? _slab_caches->find(type_key) : nullptr;
+        if (!cache)
+        {
+            IObjectBuilder::release_cached(type_key, ptr, size);
+            return;
+        }
+
+        cache->deallocate(ptr);
+    }
+};
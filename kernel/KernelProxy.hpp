@@ -2,53 +2,411 @@
 
 #include "common/diagnostics.hpp"
 #include "common/IUserRuntime.hpp"
+#include "common/PlacementNew.hpp"
+#include "common/StreamRing.hpp"
 #include "IMessageBus.hpp"
 #include "ISchedulingControl.hpp"
+#include "PlatformHooks.hpp"
 #include "ResourceManager.hpp"
+#include "TaskScheduler.hpp"
+#include "IpcService.hpp"
 
 class KernelRuntimeProxy : public IUserRuntime
 {
+public:
+    static constexpr bool SLAB_CACHED = true;
+
 private:
     IMessageBus *_bus;
-    ISchedulingControl *_sched; // 核心调整：改为依赖任务管理器接口
     PlatformHooks *_hooks;
+    TaskScheduler *_scheduler; // 仅用于内核临界区保护，可为空（测试环境）
+    IpcService *_ipc;          // 点对点信箱，可为空（测试环境）
 
 public:
     // 构造函数注入：这使得测试时可以注入 MockBus 和 MockTaskManager
-    KernelRuntimeProxy(IMessageBus *bus, PlatformHooks *hooks)
-        : _bus(bus), _hooks(hooks) {}
+    KernelRuntimeProxy(IMessageBus *bus, PlatformHooks *hooks, TaskScheduler *scheduler = nullptr, IpcService *ipc = nullptr)
+        : _bus(bus), _hooks(hooks), _scheduler(scheduler), _ipc(ipc) {}
 
-    // 消息投递：依然是透传给总线
-    void publish(const Message &msg) override
+    // 消息投递：透传给总线；显存刷新请求也经总线，由其按脏矩形合并后在分发时统一刷新
+    PublishResult publish(const Message &msg) override
     {
-        if (msg.type == MessageType::REQUEST_HARDWARE_INFO)
-        {
-            const char *hw_name = (const char *)msg.payload[0];
-            uintptr_t *out_ptr = (uintptr_t *)msg.payload[1];
+        // 代理在任务上下文中执行内核代码，期间推迟时钟抢占
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        return publish_locked(msg);
+    }
 
-            auto *res = _hooks->resource_manager->query(hw_name);
-            if (res)
-            {
-                *out_ptr = res->base_address;
-                // klog(LogLevel::Info, "Kernel: Assigned %s at 0x%p", hw_name, res->base_address);
-            }
-            else
+    /**
+     * 队列满时陷入内核阻塞，分发者腾出空间后唤醒调用方再重试；
+     * 订阅回调始终在分发者上运行，不会跑在投递任务的栈上。没有 IPC 陷入时直接返回 Full
+     */
+    PublishResult publish_wait(const Message &msg) override
+    {
+        while (true)
+        {
             {
-                *out_ptr = 0;
+                PreemptGuard guard(_scheduler, _hooks->sched_control);
+                PublishResult result = publish_locked(msg);
+                if (result != PublishResult::Full)
+                    return result;
             }
-        }
-        else if (msg.type == MessageType::EVENT_VRAM_UPDATED)
-        {
-            _hooks->refresh_display();
+
+            ITaskControlBlock *self = stage_ipc(static_cast<uint32_t>(msg.type), nullptr);
+            if (!self)
+                return PublishResult::Full;
+            _hooks->sched_control->invoke_ipc(SignalEvent::PublishWait);
+
+            // 没能阻塞（无任务可切换）而车道仍满：不再自旋
+            PreemptGuard guard(_scheduler, _hooks->sched_control);
+            if (!self->ipc.ok && !_bus->has_room(msg.type))
+                return PublishResult::Full;
         }
     }
 
+    // 批量投递：整批只进出一次临界区
+    size_t publish_batch(const Message *msgs, size_t count) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        return _bus ? _bus->publish_batch(msgs, count) : 0;
+    }
+
     // 协作调度：转交给任务管理器
     void yield() override
     {
-        if (!_sched)
+        if (!_hooks || !_hooks->sched_control)
             return;
         // 领域语义：任务请求让出执行权，管理器决定切给谁
         _hooks->sched_control->yield_current_task();
     }
+
+    void sleep_for(uint32_t ms) override
+    {
+        if (!ms)
+        {
+            yield();
+            return;
+        }
+        sleep_until(now_ms() + ms);
+    }
+
+    void sleep_until(uint64_t deadline_ms) override
+    {
+        if (!_scheduler || !_hooks->sched_control)
+            return;
+
+        {
+            PreemptGuard guard(_scheduler, _hooks->sched_control);
+            ITaskControlBlock *self = _scheduler->get_current();
+            if (!self || deadline_ms <= _scheduler->now_ms())
+                return;
+            self->wake_at_ms = deadline_ms;
+        }
+
+        // 陷入后由时间轮接管，到期时由时钟节拍放回就绪队列
+        _hooks->sched_control->invoke_ipc(SignalEvent::Sleep);
+    }
+
+    uint64_t now_ms() override
+    {
+        return _scheduler ? _scheduler->now_ms() : 0;
+    }
+
+    bool send(uint32_t task_id, const Message &msg) override
+    {
+        if (!_ipc)
+            return false;
+
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        return _ipc->send(task_id, msg);
+    }
+
+    void receive(Message &out) override
+    {
+        if (!_ipc)
+            return;
+
+        while (true)
+        {
+            {
+                PreemptGuard guard(_scheduler, _hooks->sched_control);
+                if (_ipc->try_receive(out))
+                    return;
+            }
+
+            // 信箱为空：陷入内核阻塞，被唤醒后回到这里重新取
+            if (!_hooks->sched_control)
+                return;
+            _hooks->sched_control->block_current_task();
+        }
+    }
+
+    bool call(uint32_t task_id, const Message &msg, Message &reply) override
+    {
+        // 内核服务在代理中就地完成，不发生任何切换
+        if (task_id == KERNEL_TASK_ID)
+        {
+            PreemptGuard guard(_scheduler, _hooks->sched_control);
+            return handle_kernel_call(msg, reply);
+        }
+
+        ITaskControlBlock *self = stage_ipc(task_id, &msg);
+        if (!self)
+            return false;
+
+        self->ipc.reply_buf = &reply;
+        _hooks->sched_control->invoke_ipc(SignalEvent::Call);
+        return self->ipc.ok;
+    }
+
+    bool reply_and_wait(uint32_t client_id, const Message &reply, Message &next) override
+    {
+        ITaskControlBlock *self = stage_ipc(client_id, &reply);
+        if (!self)
+            return false;
+
+        _hooks->sched_control->invoke_ipc(SignalEvent::Reply);
+        bool replied = self->ipc.ok;
+
+        // 陷入返回时信箱通常已有下一条请求；否则按常规接收路径阻塞
+        receive(next);
+        return replied;
+    }
+
+    uint32_t grant_create(uint32_t size) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        BufferGrantTable *grants = grant_table();
+        return grants ? grants->create(size, current_task_id()) : BufferGrantTable::INVALID_HANDLE;
+    }
+
+    void *grant_map(uint32_t handle, uint32_t *size) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        BufferGrantTable *grants = grant_table();
+        return grants ? grants->map(handle, current_task_id(), size) : nullptr;
+    }
+
+    bool grant_retain(uint32_t handle) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        BufferGrantTable *grants = grant_table();
+        return grants && grants->retain(handle, current_task_id());
+    }
+
+    bool grant_release(uint32_t handle) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        BufferGrantTable *grants = grant_table();
+        return grants && grants->release(handle, current_task_id());
+    }
+
+    uint32_t notification_create() override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        NotificationTable *table = notification_table();
+        return table ? table->create() : NotificationTable::INVALID_HANDLE;
+    }
+
+    bool notification_destroy(uint32_t handle) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        NotificationTable *table = notification_table();
+        return table && table->destroy(handle);
+    }
+
+    bool notify(uint32_t handle, uint64_t bits) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        return notification_table() && _ipc->notify(handle, bits);
+    }
+
+    uint64_t notification_wait(uint32_t handle) override
+    {
+        uint64_t bits = notification_poll(handle);
+        if (bits)
+            return bits;
+
+        // 没有累积的位：陷入内核等待，signal 把位直接写入 ipc.bits
+        ITaskControlBlock *self = stage_ipc(handle, nullptr);
+        if (!self || !notification_table())
+            return 0;
+
+        _hooks->sched_control->invoke_ipc(SignalEvent::Wait);
+        return self->ipc.bits;
+    }
+
+    uint64_t notification_poll(uint32_t handle) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        NotificationTable *table = notification_table();
+        Notification *n = table ? table->get(handle) : nullptr;
+        return n ? n->poll() : 0;
+    }
+
+    FutexWaitResult futex_wait(const volatile uint32_t *addr, uint32_t expected, uint32_t timeout_ms) override
+    {
+        ITaskControlBlock *self = _ipc && _ipc->futexes() ? stage_ipc(KERNEL_TASK_ID, nullptr) : nullptr;
+        if (!self)
+            return FutexWaitResult::ValueChanged;
+
+        // 比较在陷入门内（中断屏蔽）完成，与 futex_wake 互斥
+        self->ipc.futex_addr = addr;
+        self->ipc.futex_expected = expected;
+        self->wake_at_ms = timeout_ms ? _scheduler->now_ms() + timeout_ms : 0;
+        _hooks->sched_control->invoke_ipc(SignalEvent::FutexWait);
+
+        if (self->ipc.ok)
+            return FutexWaitResult::Woken;
+        return self->wait_timed_out ? FutexWaitResult::TimedOut : FutexWaitResult::ValueChanged;
+    }
+
+    uint32_t futex_wake(const volatile uint32_t *addr, uint32_t count) override
+    {
+        if (!_ipc || !_scheduler)
+            return 0;
+
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        return _ipc->futex_wake(addr, count);
+    }
+
+    uint32_t stream_create(uint32_t element_size, uint32_t capacity) override
+    {
+        // 总尺寸以 64 位计算，超出授权的 32 位尺寸时拒绝，而不是回绕成一个过小的缓冲区
+        if (!StreamRingHeader::geometry_ok(element_size, capacity))
+            return BufferGrantTable::INVALID_HANDLE;
+
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        BufferGrantTable *grants = grant_table();
+        NotificationTable *notes = notification_table();
+        if (!grants || !notes)
+            return BufferGrantTable::INVALID_HANDLE;
+
+        uint32_t owner = current_task_id();
+        uint32_t bytes = static_cast<uint32_t>(StreamRingHeader::bytes_for(element_size, capacity));
+        uint32_t handle = grants->create(bytes, owner);
+        uint32_t data_note = handle ? notes->create() : NotificationTable::INVALID_HANDLE;
+        uint32_t space_note = data_note ? notes->create() : NotificationTable::INVALID_HANDLE;
+        if (!space_note)
+        {
+            notes->destroy(data_note);
+            grants->release(handle, owner);
+            return BufferGrantTable::INVALID_HANDLE;
+        }
+
+        auto *ring = new (grants->map(handle, owner)) StreamRingHeader();
+        ring->capacity = capacity;
+        ring->element_size = element_size;
+        ring->data_note = data_note;
+        ring->space_note = space_note;
+        return handle;
+    }
+
+    bool stream_destroy(uint32_t handle) override
+    {
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        BufferGrantTable *grants = grant_table();
+        NotificationTable *notes = notification_table();
+        uint32_t owner = current_task_id();
+        auto *ring = grants && notes ? static_cast<StreamRingHeader *>(grants->map(handle, owner)) : nullptr;
+        if (!ring || ring->magic != StreamRingHeader::MAGIC)
+            return false;
+
+        notes->destroy(ring->data_note);
+        notes->destroy(ring->space_note);
+        ring->magic = 0;
+        return grants->release(handle, owner);
+    }
+
+private:
+    PublishResult publish_locked(const Message &msg)
+    {
+        if (_bus && msg.grant)
+            return publish_with_grant(msg);
+        if (_bus)
+            return _bus->publish(msg);
+
+        // 没有总线时显存刷新就地完成，其余消息无处投递
+        if (msg.type == MessageType::EVENT_VRAM_UPDATED && _hooks->refresh_display)
+        {
+            _hooks->refresh_display(VramUpdatedChannel::read(msg));
+            return PublishResult::Ok;
+        }
+        return PublishResult::Dropped;
+    }
+
+    /**
+     * @brief 大载荷通道：授权随消息交给内核，总线分发完成后释放；未入队时退回给发送方
+     */
+    PublishResult publish_with_grant(const Message &msg)
+    {
+        BufferGrantTable *grants = grant_table();
+        uint32_t self = current_task_id();
+        if (!grants || !grants->transfer(msg.grant, self, KERNEL_TASK_ID))
+            return PublishResult::Dropped;
+
+        PublishResult result = _bus->publish(msg);
+        if (result != PublishResult::Ok)
+            grants->transfer(msg.grant, KERNEL_TASK_ID, self);
+        return result;
+    }
+
+    BufferGrantTable *grant_table() const
+    {
+        return _ipc && _scheduler ? _ipc->grants() : nullptr;
+    }
+
+    NotificationTable *notification_table() const
+    {
+        return _ipc && _scheduler ? _ipc->notifications() : nullptr;
+    }
+
+    uint32_t current_task_id() const
+    {
+        ITaskControlBlock *self = _scheduler->get_current();
+        return self ? self->get_id() : KERNEL_TASK_ID;
+    }
+
+    /**
+     * @brief 暂存陷入参数（相当于装填系统调用寄存器）
+     * @return 当前任务；不具备 IPC 能力（测试环境）时返回 nullptr
+     */
+    ITaskControlBlock *stage_ipc(uint32_t partner, const Message *outgoing)
+    {
+        if (!_ipc || !_scheduler || !_hooks->sched_control)
+            return nullptr;
+
+        PreemptGuard guard(_scheduler, _hooks->sched_control);
+        ITaskControlBlock *self = _scheduler->get_current();
+        if (!self)
+            return nullptr;
+
+        self->ipc.partner = partner;
+        self->ipc.outgoing = outgoing;
+        self->ipc.ok = false;
+        return self;
+    }
+
+    /**
+     * @brief 内核自身提供的同步服务
+     */
+    bool handle_kernel_call(const Message &msg, Message &reply)
+    {
+        reply = Message{};
+        reply.type = msg.type;
+        reply.sender = KERNEL_TASK_ID;
+
+        if (msg.type == MessageType::REQUEST_HARDWARE_INFO)
+        {
+            // 请求：payload[0] = 资源名；回复：payload[0] = 基址，payload[1] = 尺寸
+            const char *hw_name = (const char *)msg.payload[0];
+            auto *res = _hooks->resource_manager ? _hooks->resource_manager->query(hw_name) : nullptr;
+            if (!res)
+                return false;
+
+            reply.payload[0] = res->base_address;
+            reply.payload[1] = res->size;
+            return true;
+        }
+
+        return false;
+    }
 };
\ No newline at end of file
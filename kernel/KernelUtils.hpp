@@ -39,6 +39,26 @@ namespace KernelUtils
 #endif
         }
 
+        /**
+         * 查找最高位的 1 (即 floor(log2(value)))，value 为 0 时返回 -1
+         */
+        static inline int find_last_set(uint64_t value)
+        {
+            if (value == 0)
+                return -1;
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            return _BitScanReverse64(&index, value) ? static_cast<int>(index) : -1;
+#elif defined(__GNUC__) || defined(__clang__)
+            return 63 - __builtin_clzll(value);
+#else
+            int index = 0;
+            while (value >>= 1)
+                index++;
+            return index;
+#endif
+        }
+
         /**
          * 检查一个无符号整数是否为 2 的幂
          * 2 的幂在二进制中只有一个位是 1 (例如: 1, 2, 4, 8, 16...)
@@ -1,23 +1,60 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <common/Message.hpp>
-#include <vector>
-#include <queue>
-#include <mutex>
 
 /**
  * Mailbox: 任务的“信箱”
- * 负责缓存发往该任务的消息
+ * 负责缓存发往该任务的消息，内嵌在 TCB 中：固定容量的环形缓冲，投递与取出不做任何动态分配
+ * 默认使用内嵌的 INLINE_CAPACITY 个槽位；需要更深积压的任务在创建时按
+ * TaskResourceConfig::mailbox_capacity 另行分配存储，经 attach_storage 接入（见 SimpleTaskFactory）
+ *
+ * 不带锁：只在平台陷入门内（中断已屏蔽）或 PreemptGuard 临界区内访问，
+ * 所有任务与内核共享同一执行流，不存在真正的并发读写
  */
 class Mailbox
 {
+public:
+    static const uint32_t INLINE_CAPACITY = 4; // 控制 TCB 尺寸，使其仍落在 slab 缓存内
+    static_assert((INLINE_CAPACITY & (INLINE_CAPACITY - 1)) == 0, "Mailbox capacity must be a power of two");
+
 private:
-    std::queue<Message> _messages;
-    std::mutex _lock; // 在模拟器环境下使用 mutex 保证并发安全
-    size_t _capacity;
+    Message _inline[INLINE_CAPACITY];
+    Message *_messages = _inline;
+    uint32_t _capacity = INLINE_CAPACITY;
+    uint32_t _head = 0; // 下一条待取出的位置（单调递增，取模访问）
+    uint32_t _tail = 0; // 下一条写入的位置
+    uint32_t _rejected = 0;
+    uint32_t _limit = INLINE_CAPACITY; // 可配置的容量上限，不超过 capacity()
+    uint32_t _high_water = 0;
 
 public:
-    explicit Mailbox(size_t capacity = 32) : _capacity(capacity) {}
+    Mailbox() = default;
+
+    // _messages 可能指向自身的内嵌槽位：禁止拷贝
+    Mailbox(const Mailbox &) = delete;
+    Mailbox &operator=(const Mailbox &) = delete;
+
+    /**
+     * @brief 改用外部存储（capacity 个槽位，2 的幂），上限随之放宽到 capacity
+     * 只能在信箱为空时调用；存储由调用方分配，并须与信箱同寿命
+     */
+    bool attach_storage(Message *storage, uint32_t capacity)
+    {
+        if (!storage || !capacity || (capacity & (capacity - 1)) || !empty())
+            return false;
+
+        _messages = storage;
+        _capacity = capacity;
+        _limit = capacity;
+        return true;
+    }
+
+    // 外部存储；使用内嵌槽位时为空
+    Message *external_storage() const { return _messages == _inline ? nullptr : _messages; }
+
+    uint32_t capacity() const { return _capacity; }
 
     /**
      * 投递消息
@@ -25,12 +62,15 @@ public:
      */
     bool push(const Message &msg)
     {
-        std::lock_guard<std::mutex> lock(_lock);
-        if (_messages.size() >= _capacity)
+        if (full())
         {
+            _rejected++;
             return false;
         }
-        _messages.push(msg);
+        _messages[_tail & (_capacity - 1)] = msg;
+        _tail++;
+        if (_tail - _head > _high_water)
+            _high_water = _tail - _head;
         return true;
     }
 
@@ -39,32 +79,39 @@ public:
      */
     bool pop(Message &out_msg)
     {
-        std::lock_guard<std::mutex> lock(_lock);
-        if (_messages.empty())
-        {
+        if (empty())
             return false;
-        }
-        out_msg = _messages.front();
-        _messages.pop();
+
+        out_msg = _messages[_head & (_capacity - 1)];
+        _head++;
         return true;
     }
 
-    bool empty()
-    {
-        std::lock_guard<std::mutex> lock(_lock);
-        return _messages.empty();
-    }
+    bool empty() const { return _head == _tail; }
+    bool full() const { return _tail - _head >= _limit; }
 
-    size_t count()
+    /**
+     * @brief 收紧容量上限（1..capacity()）：限制单个接收者能积压的消息数
+     * 需要超过 capacity() 的积压时，应在创建任务时配置 mailbox_capacity
+     * 已在信箱中的消息不受影响
+     */
+    bool set_limit(uint32_t limit)
     {
-        std::lock_guard<std::mutex> lock(_lock);
-        return _messages.size();
+        if (limit == 0 || limit > _capacity)
+            return false;
+        _limit = limit;
+        return true;
     }
 
-    void clear()
-    {
-        std::lock_guard<std::mutex> lock(_lock);
-        std::queue<Message> empty_queue;
-        _messages.swap(empty_queue);
-    }
-};
\ No newline at end of file
+    uint32_t limit() const { return _limit; }
+
+    // 曾经同时积压的最大消息数
+    uint32_t high_water() const { return _high_water; }
+
+    size_t count() const { return _tail - _head; }
+
+    // 因信箱已满被拒绝的投递次数
+    uint32_t rejected_count() const { return _rejected; }
+
+    void clear() { _head = _tail; }
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 /**
  * 体系结构无关的上下文句柄
  * 内核只看到一个指针，具体内容由底层的汇编原语解释
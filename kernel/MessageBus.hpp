@@ -4,107 +4,766 @@
 #include <common/diagnostics.hpp>
 #include "MessageCallback.hpp"
 #include "IMessageBus.hpp"
-#include "KList.hpp"
-#include "KPoolList.hpp"
+#include "MessageDispatchTable.hpp"
+#include "MpscRing.hpp"
+#include "BufferGrantTable.hpp"
+
+/**
+ * 分发车道：车道之间严格按优先级分发，车道内保持投递顺序
+ * 延迟敏感的输入走 Urgent，大量低价值事件走 Bulk，不会互相阻塞
+ */
+enum class MessageLane : uint8_t
+{
+    Urgent,
+    Normal,
+    Bulk
+};
+
+/**
+ * 车道统计：深度与等待时间由分发者在每批取出前采样
+ */
+struct MessageLaneStats
+{
+    uint64_t published = 0;
+    uint64_t dispatched = 0;
+    uint64_t dropped = 0;
+    uint64_t coalesced = 0;  // 并入已在队列中的同类型消息、未单独入队的次数
+    uint32_t depth = 0;      // 当前积压（近似）
+    uint32_t max_depth = 0;  // 采样到的最大积压
+    uint64_t max_age_us = 0; // 队头消息的最长等待时间（需注入时钟）
+    uint32_t capacity = 0;   // 当前容量上限
+};
+
+/**
+ * 按类型的积压统计
+ */
+struct MessageTypeStats
+{
+    uint32_t high_water = 0; // 单次分发中处理的最大积压（分发期间回调新投递的同类型消息也计入）
+    uint64_t dropped = 0;    // 因容量上限被拒绝的次数
+};
 
 class MessageBus : public IMessageBus
 {
+public:
+    // 投递唤醒：有消息入队时通知分发者（通常是空闲循环）
+    using WakeupHandler = void (*)(void *context);
+
+    // 单调时钟（微秒），用于分发时间预算与等待时间统计
+    using ClockSource = uint64_t (*)();
+
+    // 合并函数：把 incoming 并入 pending；必须满足交换律与幂等（如矩形并集、位或），
+    // 合并槽争用时同一事件可能被多合并或多投递一次
+    using MessageMerger = void (*)(Message &pending, const Message &incoming);
+
+    // 每条车道的待分发队列容量（可用 set_lane_capacity 收紧）；队列满时新消息被拒绝并计数
+    static const size_t QUEUE_CAPACITY = 64;
+    static const size_t LANE_COUNT = 3;
+
+    // 分发时每批从队列取出的消息数
+    static const size_t DISPATCH_BATCH = 32;
+
+    // 可覆盖默认车道的类型数
+    static const size_t MAX_LANE_OVERRIDES = 16;
+
+    // 可设置合并策略的类型数
+    static const size_t MAX_COALESCED_TYPES = 8;
+
+    // 单独统计积压与丢弃的类型数；超出的类型只计入车道统计
+    static const size_t MAX_TRACKED_TYPES = 16;
+
+    enum class DispatchMode
+    {
+        Ordered,      // 严格按投递顺序分发；相邻同类型消息共用一次订阅表查找
+        GroupedByType // 每批按类型分组分发：每种类型每批只查一次表，同类型内保持顺序，不同类型之间不保证
+    };
+
 private:
-    IObjectBuilder *_builder;
+    struct Lane
+    {
+        // 任务、中断处理程序与宿主线程都可以并发投递，只有分发者消费
+        MpscRing<Message, QUEUE_CAPACITY> queue;
+
+        std::atomic<uint64_t> dropped{0};
+        // 队头开始等待的时刻（微秒），0 表示车道为空或未计时
+        std::atomic<uint64_t> waiting_since{0};
+
+        // 以下只由分发者读写
+        uint64_t dispatched = 0;
+        uint32_t max_depth = 0;
+        uint64_t max_age_us = 0;
 
-    // 订阅者条目：管理特定消息类型的所有回调
-    struct SubscriberEntry
+        std::atomic<uint64_t> coalesced{0};
+
+        // 容量上限，只在启动阶段设置
+        uint32_t limit = QUEUE_CAPACITY;
+    };
+
+    struct TypeCounters
+    {
+        std::atomic<uint32_t> type{0}; // MessageType 的取值，0 (NONE) 表示空槽，首次使用时原子地占用
+        std::atomic<uint64_t> dropped{0};
+        uint32_t high_water = 0; // 只由分发者读写：投递路径上不增加原子操作
+        uint32_t tally = 0;      // 本次分发已处理的数量
+    };
+
+    /**
+     * 合并槽：某类型在队列中至多一个实例，后续投递的载荷并入 msg
+     * 队列中的那一条只是占位，分发时取出槽内合并后的内容
+     */
+    struct CoalesceSlot
     {
         MessageType type;
-        KList<MessageCallback> callbacks;
-        // 修正：构造函数接收 Builder 以初始化内部 KList
-        SubscriberEntry(IObjectBuilder *b) : type(MessageType::NONE), callbacks(b) {}
+        MessageMerger merge;
+        std::atomic_flag busy = ATOMIC_FLAG_INIT;
+        bool pending = false;
+        Message msg{};
     };
 
-    KList<SubscriberEntry *> _registry;
+    enum class EnqueueResult
+    {
+        Queued,
+        Merged,
+        Full
+    };
+
+    struct LaneOverride
+    {
+        MessageType type;
+        MessageLane lane;
+    };
+
+    IObjectBuilder *_builder;
+
+    WakeupHandler _wakeup = nullptr;
+    void *_wakeup_context = nullptr;
+    ClockSource _clock = nullptr;
+
+    // 携带缓冲授权的消息（大载荷通道）在分发时由此映射；为空时这类消息的载荷不可见
+    BufferGrantTable *_grants = nullptr;
+
+    // 订阅表：类型直接下标寻址，回调连续存放
+    MessageDispatchTable _subscribers;
+
+    Lane _lanes[LANE_COUNT];
+    std::atomic<uint64_t> _dropped{0};
+
+    LaneOverride _lane_overrides[MAX_LANE_OVERRIDES];
+    size_t _lane_override_count = 0;
+
+    CoalesceSlot _coalesce[MAX_COALESCED_TYPES];
+    size_t _coalesce_count = 0;
+
+    TypeCounters _type_counters[MAX_TRACKED_TYPES];
 
-    KObjectPool<ListNode<Message>> _queue_pool;
-    KPoolList<Message> _pending_queue;
+    DispatchMode _mode = DispatchMode::Ordered;
+
+    // 分发预算：单次 dispatch_messages 最多处理的消息数 / 微秒数，0 表示不限
+    uint32_t _budget_messages = 0;
+    uint32_t _budget_us = 0;
+    uint64_t _budget_exhausted = 0;
 
 public:
     // 构造函数：统一使用 IObjectBuilder
     MessageBus(IObjectBuilder *b)
-        : _builder(b), _registry(b), _queue_pool(b), _pending_queue(_queue_pool) // _registry 也是 KList，需要 builder
+        : _builder(b), _subscribers(b)
     {
     }
 
-    ~MessageBus() override
+    ~MessageBus() override = default;
+
+    void set_wakeup_handler(WakeupHandler handler, void *context)
+    {
+        _wakeup = handler;
+        _wakeup_context = context;
+    }
+
+    void set_clock(ClockSource clock) { _clock = clock; }
+
+    /**
+     * @brief 总线消息的授权由内核 (KERNEL_TASK_ID) 持有：分发前映射进 payload，分发后释放
+     * 授权表不加锁，投递与分发都须在临界区内进行
+     */
+    void set_grant_table(BufferGrantTable *grants) { _grants = grants; }
+
+    /**
+     * @brief 单次分发的预算：用完后即使仍有积压也返回，把 CPU 交还调度器
+     * @param max_messages 最多分发的消息数，0 表示不限
+     * @param max_us 最长分发时间（需注入时钟），0 表示不限
+     */
+    void set_dispatch_budget(uint32_t max_messages, uint32_t max_us)
     {
-        // 1. 清空待处理队列
-        _pending_queue.clear();
+        _budget_messages = max_messages;
+        _budget_us = max_us;
+    }
 
-        // 2. 释放所有订阅者条目对象（因为它们是 construct 出来的）
-        _registry.for_each([this](SubscriberEntry *entry)
-                           { _builder->destroy(entry); });
-        _registry.clear();
+    /**
+     * @brief 收紧某条车道的容量上限（1..QUEUE_CAPACITY）；只在启动阶段调用
+     * 上限只约束新的投递，超出的投递返回 PublishResult::Full，不会向内核堆申请额外空间
+     */
+    bool set_lane_capacity(MessageLane lane, uint32_t limit)
+    {
+        if (limit == 0 || limit > QUEUE_CAPACITY)
+            return false;
+        _lanes[static_cast<size_t>(lane)].limit = limit;
+        return true;
     }
 
+    /**
+     * @brief 覆盖某个类型的默认车道；只在启动阶段（尚无并发投递时）调用
+     */
+    bool set_lane(MessageType type, MessageLane lane)
+    {
+        for (size_t i = 0; i < _lane_override_count; ++i)
+        {
+            if (_lane_overrides[i].type == type)
+            {
+                _lane_overrides[i].lane = lane;
+                return true;
+            }
+        }
+
+        if (_lane_override_count == MAX_LANE_OVERRIDES)
+            return false;
+        _lane_overrides[_lane_override_count++] = {type, lane};
+        return true;
+    }
+
+    /**
+     * @brief 为某个类型启用入队时合并：队列中已有该类型的消息时，新消息并入其中而不再占用队列
+     * 一次分发周期内的突发因此只投递一次；只在启动阶段调用
+     */
+    bool set_coalescing(MessageType type, MessageMerger merge)
+    {
+        for (size_t i = 0; i < _coalesce_count; ++i)
+        {
+            if (_coalesce[i].type == type)
+            {
+                _coalesce[i].merge = merge;
+                return true;
+            }
+        }
+
+        if (_coalesce_count == MAX_COALESCED_TYPES || !merge)
+            return false;
+        _coalesce[_coalesce_count].type = type;
+        _coalesce[_coalesce_count].merge = merge;
+        _coalesce_count++;
+        return true;
+    }
+
+    MessageLane lane_of(MessageType type) const
+    {
+        for (size_t i = 0; i < _lane_override_count; ++i)
+        {
+            if (_lane_overrides[i].type == type)
+                return _lane_overrides[i].lane;
+        }
+
+        switch (type)
+        {
+        case MessageType::EVENT_KEYBOARD:
+            return MessageLane::Urgent;
+        case MessageType::EVENT_PRINT:
+            return MessageLane::Bulk;
+        default:
+            return MessageLane::Normal;
+        }
+    }
+
+    MessageLaneStats lane_stats(MessageLane lane) const
+    {
+        const Lane &l = _lanes[static_cast<size_t>(lane)];
+        MessageLaneStats stats;
+        stats.dropped = l.dropped.load(std::memory_order_relaxed);
+        stats.coalesced = l.coalesced.load(std::memory_order_relaxed);
+        stats.dispatched = l.dispatched;
+        stats.depth = static_cast<uint32_t>(l.queue.size_approx());
+        // 接收的投递 = 已分发 + 在队 + 被合并：投递路径上省去一次原子计数
+        stats.published = stats.dispatched + stats.depth + stats.coalesced;
+        stats.max_depth = l.max_depth;
+        stats.max_age_us = l.max_age_us;
+        stats.capacity = l.limit;
+        return stats;
+    }
+
+    MessageTypeStats type_stats(MessageType type) const
+    {
+        MessageTypeStats stats;
+        for (const TypeCounters &c : _type_counters)
+        {
+            if (c.type.load(std::memory_order_acquire) == static_cast<uint32_t>(type))
+            {
+                stats.high_water = c.high_water;
+                stats.dropped = c.dropped.load(std::memory_order_relaxed);
+                break;
+            }
+        }
+        return stats;
+    }
+
+    // 因预算用完而提前返回的次数
+    uint64_t budget_exhausted_count() const { return _budget_exhausted; }
+
     // --- IMessageBus 实现 ---
 
     void subscribe(MessageType type, MessageCallback callback) override
     {
-        auto *entry = find_or_create_entry(type);
-        if (entry)
+        _subscribers.add(type, callback);
+    }
+
+    void unsubscribe(MessageType type, MessageCallback callback) override
+    {
+        _subscribers.remove(type, callback);
+    }
+
+    PublishResult publish(const Message &msg) override
+    {
+        Lane &lane = lane_for(msg.type);
+        CoalesceSlot *slot = find_coalesce_slot(msg.type);
+        EnqueueResult result = slot ? enqueue_coalesced(lane, *slot, msg)
+                                    : (push_one(lane, msg) ? EnqueueResult::Queued : EnqueueResult::Full);
+
+        if (result == EnqueueResult::Full)
         {
-            entry->callbacks.push_back(callback);
+            count_dropped(lane, &msg, 1);
+            return PublishResult::Full;
         }
+
+        count_published(lane);
+        // 合并进已在队列中的消息时分发者必然已被唤醒过
+        if (result == EnqueueResult::Queued && _wakeup)
+            _wakeup(_wakeup_context);
+        return PublishResult::Ok;
     }
 
-    void unsubscribe(MessageType type, MessageCallback callback) override
+    /**
+     * @brief 该类型的车道此刻是否还能接收（阻塞投递的重试判断，结果只是近似）
+     */
+    bool has_room(MessageType type) const override
+    {
+        const Lane &lane = _lanes[static_cast<size_t>(lane_of(type))];
+        return lane.queue.size_approx() < lane.limit;
+    }
+
+    size_t publish_batch(const Message *msgs, size_t count) override
+    {
+        // 按车道切成连续的段，每段一次批量入队；可合并的类型逐条处理
+        size_t accepted = 0;
+        size_t begin = 0;
+        bool queued = false;
+        while (begin < count)
+        {
+            MessageLane lane_id = lane_of(msgs[begin].type);
+            CoalesceSlot *slot = find_coalesce_slot(msgs[begin].type);
+            if (slot)
+            {
+                Lane &lane = _lanes[static_cast<size_t>(lane_id)];
+                EnqueueResult result = enqueue_coalesced(lane, *slot, msgs[begin]);
+                if (result == EnqueueResult::Full)
+                {
+                    count_dropped(lane, msgs + begin, 1);
+                }
+                else
+                {
+                    count_published(lane);
+                    queued = queued || result == EnqueueResult::Queued;
+                    accepted++;
+                }
+                begin++;
+                continue;
+            }
+
+            size_t end = begin + 1;
+            while (end < count && lane_of(msgs[end].type) == lane_id && !find_coalesce_slot(msgs[end].type))
+                end++;
+
+            Lane &lane = _lanes[static_cast<size_t>(lane_id)];
+            size_t pushed = push_bounded(lane, msgs + begin, end - begin);
+
+            if (pushed)
+                count_published(lane);
+            if (pushed < end - begin)
+                count_dropped(lane, msgs + begin + pushed, end - begin - pushed);
+
+            accepted += pushed;
+            queued = queued || pushed;
+            begin = end;
+        }
+
+        // 整批只唤醒一次
+        if (queued && _wakeup)
+            _wakeup(_wakeup_context);
+        return accepted;
+    }
+
+    void set_dispatch_mode(DispatchMode mode) { _mode = mode; }
+    DispatchMode dispatch_mode() const { return _mode; }
+
+    bool has_pending() const override
     {
-        auto *entry = find_entry(type);
-        if (entry)
+        for (const Lane &lane : _lanes)
         {
-            // 修正：KList 应提供 remove_if 逻辑
-            entry->callbacks.remove_match([&callback](const MessageCallback &cb)
-                                          { return cb == callback; });
+            if (lane.queue.has_pending())
+                return true;
         }
+        return false;
     }
 
-    void publish(const Message &msg) override
+    uint64_t dropped_count() const
     {
-        _pending_queue.push_back(msg);
+        return _dropped.load(std::memory_order_relaxed);
     }
 
-    void dispatch_messages()
+    /**
+     * @brief 按车道优先级分批分发，直到队列见底或预算用完
+     * 每批之前都重新从最高优先级车道选起：回调中新投递的紧急消息会插到积压的批量消息之前
+     */
+    void dispatch_messages() override
     {
-        Message msg;
-        // 修正：pop_front 是成员函数指针调用
-        while (_pending_queue.pop_front(msg))
+        Message batch[DISPATCH_BATCH];
+        uint32_t budget = _budget_messages ? _budget_messages : UINT32_MAX;
+        uint64_t deadline = (_budget_us && _clock) ? _clock() + _budget_us : 0;
+
+        _subscribers.begin_dispatch();
+        while (true)
         {
-            auto *entry = find_entry(msg.type);
-            if (entry)
+            Lane *lane = highest_pending_lane();
+            if (!lane)
+                break;
+
+            if (!budget || (deadline && _clock() >= deadline))
             {
-                entry->callbacks.for_each([&msg](const MessageCallback &cb)
-                                          { cb.invoke(msg); });
+                _budget_exhausted++;
+                break;
             }
+
+            sample(*lane);
+
+            size_t count = 0;
+            lane->queue.drain([&](const Message &msg)
+                              { batch[count++] = msg; },
+                              budget < DISPATCH_BATCH ? budget : DISPATCH_BATCH);
+            lane->dispatched += count;
+            budget -= static_cast<uint32_t>(count);
+            tally_types(batch, count);
+            restart_wait(*lane);
+            resolve_coalesced(batch, count);
+            if (_grants)
+                map_grants(batch, count);
+
+            if (_mode == DispatchMode::GroupedByType)
+                deliver_grouped(batch, count);
+            else
+                deliver_ordered(batch, count);
+
+            if (_grants)
+                release_grants(batch, count);
         }
+        _subscribers.end_dispatch();
+
+        flush_tallies();
     }
 
 private:
-    SubscriberEntry *find_entry(MessageType type)
+    Lane &lane_for(MessageType type)
     {
-        return _registry.find_match([type](SubscriberEntry *e)
-                                    { return e->type == type; });
+        return _lanes[static_cast<size_t>(lane_of(type))];
     }
 
-    SubscriberEntry *find_or_create_entry(MessageType type)
+    CoalesceSlot *find_coalesce_slot(MessageType type)
     {
-        auto *entry = find_entry(type);
-        if (!entry)
+        for (size_t i = 0; i < _coalesce_count; ++i)
+        {
+            if (_coalesce[i].type == type)
+                return &_coalesce[i];
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief 可合并消息入队：槽内已有待分发实例时只合并载荷
+     * 槽被占用（另一投递者正持有，或被中断打断的投递者）时不等待，按普通消息入队：
+     * 合并函数幂等，多出的一条只是少合并一次
+     */
+    EnqueueResult enqueue_coalesced(Lane &lane, CoalesceSlot &slot, const Message &msg)
+    {
+        if (slot.busy.test_and_set(std::memory_order_acquire))
+            return push_one(lane, msg) ? EnqueueResult::Queued : EnqueueResult::Full;
+
+        EnqueueResult result = EnqueueResult::Merged;
+        if (slot.pending)
+        {
+            slot.merge(slot.msg, msg);
+            lane.coalesced.fetch_add(1, std::memory_order_relaxed);
+            // 可合并的类型不应携带授权；万一携带，被合并掉的那份不再有人释放
+            if (msg.grant && _grants)
+                _grants->release(msg.grant, KERNEL_TASK_ID);
+        }
+        else if (push_one(lane, msg))
+        {
+            slot.msg = msg;
+            slot.pending = true;
+            result = EnqueueResult::Queued;
+        }
+        else
+        {
+            result = EnqueueResult::Full;
+        }
+
+        slot.busy.clear(std::memory_order_release);
+        return result;
+    }
+
+    /**
+     * @brief 把取出的占位消息换成槽内合并后的内容，槽随之清空
+     * 持有槽的投递者不会被分发者打断（中断上下文只尝试加锁），这里可以自旋
+     */
+    void resolve_coalesced(Message *batch, size_t count)
+    {
+        if (!_coalesce_count)
+            return;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            CoalesceSlot *slot = find_coalesce_slot(batch[i].type);
+            if (!slot)
+                continue;
+
+            while (slot->busy.test_and_set(std::memory_order_acquire))
+            {
+            }
+            if (slot->pending)
+            {
+                slot->merge(batch[i], slot->msg);
+                slot->pending = false;
+            }
+            slot->busy.clear(std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief 把授权映射为 payload[0] = 地址、payload[1] = 尺寸（Channel::view 的约定）
+     */
+    void map_grants(Message *batch, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Message &msg = batch[i];
+            if (!msg.grant)
+                continue;
+
+            uint32_t size = 0;
+            void *data = _grants->map(msg.grant, KERNEL_TASK_ID, &size);
+            msg.payload[0] = reinterpret_cast<uintptr_t>(data);
+            msg.payload[1] = data ? size : 0;
+        }
+    }
+
+    void release_grants(const Message *batch, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (batch[i].grant)
+                _grants->release(batch[i].grant, KERNEL_TASK_ID);
+        }
+    }
+
+    Lane *highest_pending_lane()
+    {
+        for (Lane &lane : _lanes)
+        {
+            if (lane.queue.has_pending())
+                return &lane;
+        }
+        return nullptr;
+    }
+
+    void count_published(Lane &lane)
+    {
+        // 车道由空转为非空：开始为队头计时
+        if (_clock && lane.waiting_since.load(std::memory_order_relaxed) == 0)
+        {
+            uint64_t expected = 0;
+            lane.waiting_since.compare_exchange_strong(expected, _clock(), std::memory_order_relaxed);
+        }
+    }
+
+    void count_dropped(Lane &lane, const Message *msgs, size_t count)
+    {
+        lane.dropped.fetch_add(count, std::memory_order_relaxed);
+        _dropped.fetch_add(count, std::memory_order_relaxed);
+
+        for (size_t i = 0; i < count; ++i)
         {
-            entry = _builder->construct<SubscriberEntry>(_builder);
+            TypeCounters *c = counters_for(msgs[i].type);
+            if (c)
+                c->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 在容量上限内入队，返回实际入队的条数
+     */
+    size_t push_bounded(Lane &lane, const Message *msgs, size_t count)
+    {
+        if (lane.limit < QUEUE_CAPACITY)
+        {
+            size_t depth = lane.queue.size_approx();
+            size_t room = depth < lane.limit ? lane.limit - depth : 0;
+            if (count > room)
+                count = room;
+        }
+
+        size_t pushed = 0;
+        while (pushed < count)
+        {
+            size_t n = lane.queue.try_push_batch(msgs + pushed, count - pushed);
+            if (!n)
+                break;
+            pushed += n;
+        }
+        return pushed;
+    }
+
+    bool push_one(Lane &lane, const Message &msg)
+    {
+        if (lane.limit < QUEUE_CAPACITY && lane.queue.size_approx() >= lane.limit)
+            return false;
+        return lane.queue.try_push(msg);
+    }
+
+    /**
+     * @brief 按类型游程累计本次分发处理的数量
+     */
+    void tally_types(const Message *msgs, size_t count)
+    {
+        size_t i = 0;
+        while (i < count)
+        {
+            MessageType type = msgs[i].type;
+            uint32_t run = 1;
+            while (i + run < count && msgs[i + run].type == type)
+                run++;
+            i += run;
+
+            TypeCounters *c = counters_for(type);
+            if (c)
+                c->tally += run;
+        }
+    }
+
+    void flush_tallies()
+    {
+        // 槽位按顺序占用：遇到空槽即可停止
+        for (TypeCounters &c : _type_counters)
+        {
+            if (!c.type.load(std::memory_order_relaxed))
+                break;
+            if (c.tally > c.high_water)
+                c.high_water = c.tally;
+            c.tally = 0;
+        }
+    }
+
+    /**
+     * @brief 查找或占用该类型的计数槽；槽位用尽时返回 nullptr（不单独统计）
+     */
+    TypeCounters *counters_for(MessageType type)
+    {
+        uint32_t key = static_cast<uint32_t>(type);
+        if (key == 0)
+            return nullptr;
+
+        for (TypeCounters &c : _type_counters)
+        {
+            uint32_t current = c.type.load(std::memory_order_acquire);
+            if (current == key)
+                return &c;
+            if (current == 0)
+            {
+                if (c.type.compare_exchange_strong(current, key, std::memory_order_acq_rel) || current == key)
+                    return &c;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief 取出前采样积压深度与队头等待时间
+     */
+    void sample(Lane &lane)
+    {
+        uint32_t depth = static_cast<uint32_t>(lane.queue.size_approx());
+        if (depth > lane.max_depth)
+            lane.max_depth = depth;
+
+        uint64_t since = lane.waiting_since.load(std::memory_order_relaxed);
+        if (_clock && since)
+        {
+            uint64_t now = _clock();
+            uint64_t age = now > since ? now - since : 0;
+            if (age > lane.max_age_us)
+                lane.max_age_us = age;
+        }
+    }
+
+    /**
+     * @brief 一批取出后重新计时：剩余积压的等待从此刻算起（近似值，偏小）
+     */
+    void restart_wait(Lane &lane)
+    {
+        lane.waiting_since.store(0, std::memory_order_relaxed);
+        if (_clock && lane.queue.has_pending())
+            lane.waiting_since.store(_clock(), std::memory_order_relaxed);
+    }
+
+    void deliver_ordered(const Message *batch, size_t count)
+    {
+        const MessageDispatchTable::Entry *entry = nullptr;
+        MessageType resolved = MessageType::NONE;
+        bool has_resolved = false;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!has_resolved || batch[i].type != resolved)
+            {
+                resolved = batch[i].type;
+                entry = _subscribers.find(resolved);
+                has_resolved = true;
+            }
             if (entry)
+                invoke_all(*entry, batch[i]);
+        }
+    }
+
+    void deliver_grouped(const Message *batch, size_t count)
+    {
+        // 已处理的消息打上标记，每种类型只查一次表并扫一遍批次
+        bool done[DISPATCH_BATCH] = {};
+        for (size_t first = 0; first < count; ++first)
+        {
+            if (done[first])
+                continue;
+
+            MessageType type = batch[first].type;
+            const MessageDispatchTable::Entry *entry = _subscribers.find(type);
+            for (size_t i = first; i < count; ++i)
             {
-                entry->type = type;
-                _registry.push_back(entry);
+                if (done[i] || batch[i].type != type)
+                    continue;
+                done[i] = true;
+                if (entry)
+                    invoke_all(*entry, batch[i]);
             }
         }
-        return entry;
+    }
+
+    static void invoke_all(const MessageDispatchTable::Entry &entry, const Message &msg)
+    {
+        // 派发期间下标稳定：只送给派发开始时已有的订阅者，回调中退订的订阅者已被清空、随即跳过
+        uint32_t count = entry.count;
+        for (uint32_t i = 0; i < count; ++i)
+            entry.callbacks[i].invoke(msg);
     }
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include <common/Message.hpp>
+#include <common/Channel.hpp>
 
 // 这个宏的作用是：自动生成一个静态的“跳板”并打包成 MessageCallback 对象
 #define BIND_MESSAGE_CB(Class, Func, ObjPtr)                                     \
@@ -44,4 +45,26 @@ struct MessageCallback
 
     // 判断是否有效
     bool is_valid() const { return func != nullptr; }
-};
\ No newline at end of file
+};
+
+/**
+ * 类型化订阅：为 (通道, 处理函数) 生成专属跳板，处理函数在跳板内直接调用、可被内联，
+ * 载荷按通道的类型取出，不做任何 reinterpret_cast
+ */
+template <typename Ch, typename C, void (C::*Handler)(const typename Ch::Payload &)>
+struct ChannelTrampoline
+{
+    static void invoke(const Message &msg, void *ctx)
+    {
+        typename Ch::Payload storage;
+        const typename Ch::Payload *payload = Ch::view(msg, storage);
+        if (payload)
+            (static_cast<C *>(ctx)->*Handler)(*payload);
+    }
+};
+
+template <typename Ch, typename C, void (C::*Handler)(const typename Ch::Payload &)>
+MessageCallback channel_callback(C *obj)
+{
+    return MessageCallback(&ChannelTrampoline<Ch, C, Handler>::invoke, static_cast<void *>(obj));
+}
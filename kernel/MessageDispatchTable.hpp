@@ -0,0 +1,279 @@
+#pragma once
+
+#include <common/Message.hpp>
+#include <common/diagnostics.hpp>
+#include "MessageCallback.hpp"
+#include "IObjectBuilder.hpp"
+
+/**
+ * MessageDispatchTable: 按 MessageType 索引的扁平订阅表
+ * - MessageType 按 0x100 分组，组内取值稠密且很小：前 DIRECT_GROUPS 组的低 DIRECT_SPAN 个取值直接下标寻址
+ * - 其余稀疏取值落入小型开放寻址表（线性探测；条目只增不删，无需墓碑）
+ * - 每个类型的回调连续存放：少量回调内联在条目中，超出后整体迁移到 Builder 分配的数组
+ * 派发 = 一次查表 + 一段连续内存的线性扫描
+ *
+ * 回调中可以订阅 / 退订：begin_dispatch 与 end_dispatch 之间回调数组的下标保持稳定——
+ * 退订只把回调清空（invoke 跳过空回调），扩容换下的旧数组也暂不释放，两者都推迟到 end_dispatch
+ */
+class MessageDispatchTable
+{
+public:
+    static const uint32_t DIRECT_GROUPS = 4;
+    static const uint32_t DIRECT_SPAN = 32;
+    static const uint32_t DIRECT_SLOTS = DIRECT_GROUPS * DIRECT_SPAN;
+
+    static const uint32_t FALLBACK_SLOTS = 32; // 2 的幂
+    static const uint32_t MAX_TYPES = 32;
+    static const uint32_t INLINE_CALLBACKS = 4;
+    static const uint32_t MAX_RETIRED = 8; // 一次派发期间最多推迟释放的旧数组
+
+    struct Entry
+    {
+        MessageType type = MessageType::NONE;
+        uint32_t count = 0;
+        uint32_t capacity = INLINE_CALLBACKS;
+        MessageCallback *callbacks = nullptr; // 指向 inline_callbacks 或外部数组
+        MessageCallback inline_callbacks[INLINE_CALLBACKS];
+    };
+
+private:
+    struct FallbackSlot
+    {
+        MessageType type;
+        uint8_t entry; // 条目下标 + 1，0 表示空槽
+    };
+
+    IObjectBuilder *_builder;
+
+    // 条目下标 + 1，0 表示该类型尚无订阅
+    uint8_t _direct[DIRECT_SLOTS] = {};
+    FallbackSlot _fallback[FALLBACK_SLOTS] = {};
+
+    Entry _entries[MAX_TYPES];
+    uint32_t _entry_count = 0;
+
+    // 派发期间推迟的工作
+    struct RetiredArray
+    {
+        MessageCallback *items;
+        uint32_t capacity;
+    };
+    RetiredArray _retired[MAX_RETIRED] = {};
+    uint32_t _retired_count = 0;
+    uint32_t _dispatch_depth = 0;
+    bool _needs_compaction = false;
+
+public:
+    explicit MessageDispatchTable(IObjectBuilder *builder) : _builder(builder) {}
+
+    ~MessageDispatchTable()
+    {
+        release_retired();
+        for (uint32_t i = 0; i < _entry_count; ++i)
+        {
+            Entry &entry = _entries[i];
+            if (entry.callbacks != entry.inline_callbacks)
+                _builder->destroy_array(entry.callbacks, entry.capacity);
+        }
+    }
+
+    MessageDispatchTable(const MessageDispatchTable &) = delete;
+    MessageDispatchTable &operator=(const MessageDispatchTable &) = delete;
+
+    /**
+     * @brief 查找类型对应的条目，不存在时返回 nullptr（派发热路径）
+     */
+    const Entry *find(MessageType type) const
+    {
+        uint32_t slot;
+        if (direct_slot(type, slot))
+        {
+            uint8_t index = _direct[slot];
+            return index ? &_entries[index - 1] : nullptr;
+        }
+
+        for (uint32_t probe = 0, i = hash(type); probe < FALLBACK_SLOTS; ++probe, i = (i + 1) & (FALLBACK_SLOTS - 1))
+        {
+            const FallbackSlot &s = _fallback[i];
+            if (!s.entry)
+                return nullptr;
+            if (s.type == type)
+                return &_entries[s.entry - 1];
+        }
+        return nullptr;
+    }
+
+    bool add(MessageType type, const MessageCallback &cb)
+    {
+        Entry *entry = find_or_create(type);
+        if (!entry)
+        {
+            K_WARN("MessageDispatchTable: no room for type 0x%x", static_cast<uint32_t>(type));
+            return false;
+        }
+
+        if (entry->count == entry->capacity && !grow(*entry))
+            return false;
+
+        entry->callbacks[entry->count++] = cb;
+        return true;
+    }
+
+    /**
+     * @brief 移除所有与 cb 相等的回调，保持其余回调的注册顺序
+     * 派发期间只清空回调，压缩推迟到 end_dispatch
+     * @return 移除的数量
+     */
+    uint32_t remove(MessageType type, const MessageCallback &cb)
+    {
+        Entry *entry = const_cast<Entry *>(find(type));
+        if (!entry)
+            return 0;
+
+        if (_dispatch_depth > 0)
+        {
+            uint32_t cleared = 0;
+            for (uint32_t i = 0; i < entry->count; ++i)
+            {
+                if (entry->callbacks[i] == cb)
+                {
+                    entry->callbacks[i] = MessageCallback();
+                    cleared++;
+                }
+            }
+            _needs_compaction |= cleared > 0;
+            return cleared;
+        }
+
+        return compact(*entry, cb);
+    }
+
+    /**
+     * @brief 派发开始 / 结束（可嵌套）：其间回调数组的下标与内存保持有效
+     */
+    void begin_dispatch() { _dispatch_depth++; }
+
+    void end_dispatch()
+    {
+        if (--_dispatch_depth > 0)
+            return;
+
+        release_retired();
+        if (_needs_compaction)
+        {
+            _needs_compaction = false;
+            for (uint32_t i = 0; i < _entry_count; ++i)
+                compact(_entries[i], MessageCallback());
+        }
+    }
+
+    uint32_t type_count() const { return _entry_count; }
+
+private:
+    /**
+     * @brief 删去与 cb 相等的回调并前移其余回调
+     */
+    static uint32_t compact(Entry &entry, const MessageCallback &cb)
+    {
+        uint32_t kept = 0;
+        for (uint32_t i = 0; i < entry.count; ++i)
+        {
+            if (!(entry.callbacks[i] == cb))
+                entry.callbacks[kept++] = entry.callbacks[i];
+        }
+
+        uint32_t removed = entry.count - kept;
+        entry.count = kept;
+        return removed;
+    }
+
+    void release_retired()
+    {
+        for (uint32_t i = 0; i < _retired_count; ++i)
+            _builder->destroy_array(_retired[i].items, _retired[i].capacity);
+        _retired_count = 0;
+    }
+
+    static bool direct_slot(MessageType type, uint32_t &slot)
+    {
+        uint32_t value = static_cast<uint32_t>(type);
+        uint32_t group = value >> 8;
+        uint32_t offset = value & 0xFF;
+        if (group >= DIRECT_GROUPS || offset >= DIRECT_SPAN)
+            return false;
+
+        slot = group * DIRECT_SPAN + offset;
+        return true;
+    }
+
+    static uint32_t hash(MessageType type)
+    {
+        uint32_t v = static_cast<uint32_t>(type) * 0x9E3779B1u;
+        return (v >> 16) & (FALLBACK_SLOTS - 1);
+    }
+
+    Entry *find_or_create(MessageType type)
+    {
+        Entry *existing = const_cast<Entry *>(find(type));
+        if (existing)
+            return existing;
+
+        if (_entry_count >= MAX_TYPES)
+            return nullptr;
+
+        uint8_t *index_slot = nullptr;
+        uint32_t slot;
+        if (direct_slot(type, slot))
+        {
+            index_slot = &_direct[slot];
+        }
+        else
+        {
+            for (uint32_t probe = 0, i = hash(type); probe < FALLBACK_SLOTS; ++probe, i = (i + 1) & (FALLBACK_SLOTS - 1))
+            {
+                if (!_fallback[i].entry)
+                {
+                    _fallback[i].type = type;
+                    index_slot = &_fallback[i].entry;
+                    break;
+                }
+            }
+            if (!index_slot)
+                return nullptr;
+        }
+
+        Entry &entry = _entries[_entry_count++];
+        entry.type = type;
+        entry.callbacks = entry.inline_callbacks;
+        *index_slot = static_cast<uint8_t>(_entry_count);
+        return &entry;
+    }
+
+    bool grow(Entry &entry)
+    {
+        bool heap_array = entry.callbacks != entry.inline_callbacks;
+        if (heap_array && _dispatch_depth > 0 && _retired_count == MAX_RETIRED)
+        {
+            K_WARN("MessageDispatchTable: too many subscriptions during dispatch");
+            return false;
+        }
+
+        uint32_t new_capacity = entry.capacity * 2;
+        MessageCallback *items = _builder->construct_array<MessageCallback>(new_capacity);
+        if (!items)
+            return false;
+
+        for (uint32_t i = 0; i < entry.count; ++i)
+            items[i] = entry.callbacks[i];
+
+        // 正在派发时旧数组里可能有正在执行的回调：推迟到 end_dispatch 释放
+        if (heap_array && _dispatch_depth > 0)
+            _retired[_retired_count++] = {entry.callbacks, entry.capacity};
+        else if (heap_array)
+            _builder->destroy_array(entry.callbacks, entry.capacity);
+
+        entry.callbacks = items;
+        entry.capacity = new_capacity;
+        return true;
+    }
+};
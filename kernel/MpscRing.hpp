@@ -0,0 +1,188 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * MpscRing: 有界多生产者/单消费者环形队列（按槽位序号同步）
+ * - 每个槽位携带序号：seq == pos 表示可写，seq == pos + 1 表示已写入可读，
+ *   消费后置为 pos + Capacity 交给下一圈的生产者
+ * - 生产者只在 tail 上做 CAS 抢占位置，失败仅因为其他生产者成功（lock-free），
+ *   不加锁、不等待消费者，因此可以在中断处理程序（宿主信号）中调用；队列满时立即返回 false
+ * - head 只由消费者推进（release 发布，供生产者估计深度），批量取出后逐槽释放；槽位与两端游标各占独立缓存行，避免伪共享
+ *
+ * @tparam T 槽位元素，需可平凡拷贝
+ * @tparam Capacity 槽位数，必须是 2 的幂
+ */
+template <typename T, size_t Capacity>
+class MpscRing
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "MpscRing capacity must be a power of two");
+
+public:
+    static const size_t CACHE_LINE = 64;
+
+private:
+    struct alignas(CACHE_LINE) Slot
+    {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    static const size_t MASK = Capacity - 1;
+
+    alignas(CACHE_LINE) std::atomic<size_t> _tail{0}; // 生产者共享
+    alignas(CACHE_LINE) std::atomic<size_t> _head{0}; // 只由消费者写入
+    alignas(CACHE_LINE) Slot _slots[Capacity];
+
+public:
+    MpscRing()
+    {
+        for (size_t i = 0; i < Capacity; ++i)
+            _slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing &) = delete;
+    MpscRing &operator=(const MpscRing &) = delete;
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    /**
+     * @brief 生产者入队（任意线程 / 中断上下文）
+     * @return 队列已满时返回 false，元素未入队
+     */
+    bool try_push(const T &value)
+    {
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot &slot = _slots[pos & MASK];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                // 槽位空闲：抢占该位置；失败时 pos 被刷新为最新的 tail
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    slot.value = value;
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // 槽位仍被上一圈占用：队列已满
+                return false;
+            }
+            else
+            {
+                // 其他生产者已抢先推进
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief 批量入队：一次 CAS 占下一段连续位置，再逐槽写入并发布
+     * 消费者按序释放槽位，因此一段位置的最后一个槽位空闲即意味着整段空闲
+     * @return 实际入队的数量；队列剩余空间不足时只写入前面的部分
+     */
+    size_t try_push_batch(const T *values, size_t count)
+    {
+        if (count == 0)
+            return 0;
+
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        size_t claimed;
+        while (true)
+        {
+            intptr_t diff = static_cast<intptr_t>(_slots[pos & MASK].seq.load(std::memory_order_acquire)) - static_cast<intptr_t>(pos);
+            if (diff < 0)
+                return 0; // 已满
+            if (diff > 0)
+            {
+                pos = _tail.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            // 从期望长度向下收缩到实际空闲的长度
+            claimed = count < Capacity ? count : Capacity;
+            while (claimed > 1)
+            {
+                size_t last = pos + claimed - 1;
+                if (_slots[last & MASK].seq.load(std::memory_order_acquire) == last)
+                    break;
+                claimed--;
+            }
+
+            if (_tail.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+                break;
+        }
+
+        for (size_t i = 0; i < claimed; ++i)
+        {
+            Slot &slot = _slots[(pos + i) & MASK];
+            slot.value = values[i];
+            slot.seq.store(pos + i + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    /**
+     * @brief 消费者出队（仅限唯一的消费者）
+     */
+    bool try_pop(T &out)
+    {
+        size_t head = _head.load(std::memory_order_relaxed);
+        Slot &slot = _slots[head & MASK];
+        if (slot.seq.load(std::memory_order_acquire) != head + 1)
+            return false;
+
+        out = slot.value;
+        slot.seq.store(head + Capacity, std::memory_order_release);
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 批量取出：连续消费已就绪的槽位，遇到未写完的槽位即停止
+     * 元素先拷出并释放槽位再交给 f，f 内部再次入队不会自锁
+     * @param f 形如 void(const T &)
+     * @return 本次取出的数量
+     */
+    template <typename F>
+    size_t drain(F f, size_t max_items = Capacity)
+    {
+        size_t count = 0;
+        T value;
+        while (count < max_items && try_pop(value))
+        {
+            f(value);
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * @brief 消费者视角下是否还有已就绪的元素
+     */
+    bool has_pending() const
+    {
+        size_t head = _head.load(std::memory_order_relaxed);
+        const Slot &slot = _slots[head & MASK];
+        return slot.seq.load(std::memory_order_acquire) == head + 1;
+    }
+
+    /**
+     * @brief 近似长度：任意线程可调用（生产者据此执行软容量上限），并发下可能略有滞后
+     */
+    size_t size_approx() const
+    {
+        // 先读 head 再读 tail：tail 只增不减，结果不会为负
+        size_t head = _head.load(std::memory_order_acquire);
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        return tail >= head ? tail - head : 0;
+    }
+};
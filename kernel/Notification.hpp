@@ -0,0 +1,181 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "ITaskControlBlock.hpp"
+#include "TaskScheduler.hpp"
+#include "WaitQueue.hpp"
+
+/**
+ * Notification: 轻量通知对象（信号位）
+ * 一个 64 位待处理字加一条等待队列：signal 把位或进待处理字，有等待者时直接交给队首并唤醒它；
+ * wait 取走并清空累积的位，没有时阻塞。既不复制 Message，也不经过总线队列与分发
+ *
+ * 等待者挂在 WaitQueue 上，阻塞与唤醒都经调度器完成
+ * 与 Mailbox 相同，只在陷入门、中断处理或 PreemptGuard 临界区内访问；
+ * 中断打断了内核临界区时就绪队列可能正被修改，此时只能 signal_deferred，由 flush 在临界区外补做唤醒
+ */
+class Notification
+{
+private:
+    std::atomic<uint64_t> _pending{0};
+    std::atomic<bool> _wake_deferred{false}; // signal_deferred 留下、尚未交付给等待者的位
+    WaitQueue _waiters;
+
+public:
+    /**
+     * @brief 置位；有等待者时连同已累积的位一起交给队首等待者
+     * @return 是否唤醒了等待者
+     */
+    bool signal(TaskScheduler &scheduler, uint64_t bits)
+    {
+        if (!bits)
+            return false;
+
+        ITaskControlBlock *waiter = scheduler.wake_one(_waiters);
+        if (!waiter)
+        {
+            _pending.fetch_or(bits, std::memory_order_release);
+            return false;
+        }
+
+        waiter->ipc.bits = bits | _pending.exchange(0, std::memory_order_acq_rel);
+        waiter->ipc.wait = IpcWait::None;
+        return true;
+    }
+
+    /**
+     * @brief 只置位、不碰等待队列与就绪队列：供打断了内核临界区的中断处理使用，唤醒由 flush 补做
+     */
+    void signal_deferred(uint64_t bits)
+    {
+        if (!bits)
+            return;
+
+        _pending.fetch_or(bits, std::memory_order_release);
+        _wake_deferred.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief 补做 signal_deferred 推迟的唤醒：把累积的位交给队首等待者
+     * @return 是否唤醒了等待者
+     */
+    bool flush(TaskScheduler &scheduler)
+    {
+        if (!_wake_deferred.exchange(false, std::memory_order_acq_rel))
+            return false;
+        return signal(scheduler, _pending.exchange(0, std::memory_order_acq_rel));
+    }
+
+    /**
+     * @brief 非阻塞地取走并清空累积的位
+     */
+    uint64_t poll()
+    {
+        if (!_pending.load(std::memory_order_relaxed))
+            return 0;
+        return _pending.exchange(0, std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief 陷入：取走累积的位写入 ipc.bits；为零时阻塞当前任务，直到 signal 交付
+     */
+    void wait(TaskScheduler &scheduler)
+    {
+        ITaskControlBlock *current = scheduler.get_current();
+        if (!current)
+            return;
+
+        current->ipc.bits = poll();
+        if (current->ipc.bits)
+            return;
+
+        current->ipc.wait = IpcWait::Notification;
+        if (!scheduler.block_on(_waiters))
+            current->ipc.wait = IpcWait::None;
+    }
+
+    uint64_t pending() const { return _pending.load(std::memory_order_relaxed); }
+    size_t waiter_count() const { return _waiters.size(); }
+};
+
+/**
+ * NotificationTable: 固定容量的通知对象表，句柄 = 下标 + 1（0 无效）
+ * 对象随表一次性分配，创建与销毁只翻转占用标记
+ */
+class NotificationTable
+{
+public:
+    static const uint32_t MAX_NOTIFICATIONS = 32;
+    static const uint32_t INVALID_HANDLE = 0;
+
+private:
+    Notification _slots[MAX_NOTIFICATIONS];
+    bool _used[MAX_NOTIFICATIONS] = {};
+    uint32_t _live = 0;
+
+public:
+    NotificationTable() = default;
+    NotificationTable(const NotificationTable &) = delete;
+    NotificationTable &operator=(const NotificationTable &) = delete;
+
+    /**
+     * @return 表满时返回 INVALID_HANDLE
+     */
+    uint32_t create()
+    {
+        for (uint32_t i = 0; i < MAX_NOTIFICATIONS; ++i)
+        {
+            if (_used[i])
+                continue;
+
+            _used[i] = true;
+            _slots[i].poll();
+            _live++;
+            return i + 1;
+        }
+        return INVALID_HANDLE;
+    }
+
+    /**
+     * @brief 仍有任务等待时拒绝销毁
+     */
+    bool destroy(uint32_t handle)
+    {
+        Notification *n = get(handle);
+        if (!n || n->waiter_count())
+            return false;
+
+        _used[handle - 1] = false;
+        _live--;
+        return true;
+    }
+
+    /**
+     * @return 句柄无效或未创建时返回 nullptr
+     */
+    Notification *get(uint32_t handle)
+    {
+        if (handle == INVALID_HANDLE || handle > MAX_NOTIFICATIONS || !_used[handle - 1])
+            return nullptr;
+        return &_slots[handle - 1];
+    }
+
+    /**
+     * @brief 补做所有通知对象上推迟的唤醒
+     * @return 唤醒的任务数
+     */
+    uint32_t flush_deferred(TaskScheduler &scheduler)
+    {
+        uint32_t woken = 0;
+        for (uint32_t i = 0; i < MAX_NOTIFICATIONS; ++i)
+        {
+            if (_used[i] && _slots[i].flush(scheduler))
+                woken++;
+        }
+        return woken;
+    }
+
+    uint32_t live_count() const { return _live; }
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <common/DisplayRegs.hpp>
 #include "ISchedulingControl.hpp"
 #include "ITaskContextFactory.hpp"
 #include "ResourceManager.hpp"
@@ -19,10 +20,24 @@ struct PlatformHooks
 
     // 平台相关的基础行为
     void (*reboot)();
-    void (*halt)();
+    void (*halt)(); // 等待下一个中断；返回前必须打开中断（相当于 sti; hlt）
+
+    // 启动/停止周期性时钟中断（以 SignalEvent::Timer 送达 dispatcher）；为空表示平台只支持协作调度
+    void (*start_timer)(uint32_t period_ms);
+    void (*stop_timer)();
+
+    // 事件等待/唤醒（tickless 空闲）：wait_for_event 打开中断后阻塞，
+    // 直到 notify_event、任意中断或超时（timeout_ms 为 0 表示不设超时）才返回；
+    // notify_event 可在中断上下文中调用，先于等待发生的通知不会丢失。为空时退回 halt
+    void (*wait_for_event)(uint32_t timeout_ms);
+    void (*notify_event)();
+
+    // 单调时钟（微秒），用于总线分发预算与延迟统计；为空时只按消息数限制
+    uint64_t (*monotonic_us)();
 
     // 内存相关的平台特性
     void *(*get_initial_heap_base)();
 
-    void (*refresh_display)();
+    // 把显存的脏区域刷新到屏幕；整屏矩形表示全部重绘
+    void (*refresh_display)(const DirtyRect &dirty);
 };
\ No newline at end of file
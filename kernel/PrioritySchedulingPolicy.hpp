@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ISchedulingPolicy.hpp"
+#include "ITaskControlBlock.hpp"
+
+/**
+ * PrioritySchedulingPolicy: 静态优先级 + 分级时间片
+ * - 优先级直接取自任务的资源配置，不做动态调整
+ * - 高优先级任务时间片更短（响应优先），低优先级任务时间片更长（吞吐优先）
+ * - 只有严格更高优先级的就绪任务才会立即抢占；同级之间靠时间片耗尽轮转
+ */
+class PrioritySchedulingPolicy : public ISchedulingPolicy
+{
+public:
+    static const uint32_t DEFAULT_SLICE_MS = 20;
+
+private:
+    static const int LEVELS = static_cast<int>(TaskPriority::ROOT) + 1;
+
+    // 按 TaskPriority 索引：IDLE, LOW, NORMAL, HIGH, REALTIME, ROOT
+    static constexpr uint32_t SLICE_MS[LEVELS] = {50, 40, 20, 10, 5, 20};
+
+public:
+    TaskPriority calculate_priority(ITaskControlBlock *tcb) override
+    {
+        return tcb->get_resource_config().priority;
+    }
+
+    uint32_t get_time_slice_ms(ITaskControlBlock *tcb) override
+    {
+        int level = static_cast<int>(calculate_priority(tcb));
+        return (level >= 0 && level < LEVELS) ? SLICE_MS[level] : DEFAULT_SLICE_MS;
+    }
+
+    bool should_preempt(ITaskControlBlock *current, ITaskControlBlock *next) override
+    {
+        if (!current || !next)
+            return false;
+        return static_cast<int>(calculate_priority(next)) > static_cast<int>(calculate_priority(current));
+    }
+};
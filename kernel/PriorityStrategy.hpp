@@ -0,0 +1,87 @@
+#pragma once
+
+#include "ISchedulingStrategy.hpp"
+#include "ITaskControlBlock.hpp"
+#include "KernelUtils.hpp"
+
+/**
+ * PriorityStrategy: 多级就绪队列 + 就绪位图
+ * - 每个 TaskPriority 等级一条侵入式 FIFO，同级之间轮转
+ * - 位图第 N 位表示等级 N 的队列非空，选取 = 一次最高位扫描 + 一次出队，与任务数量无关
+ */
+class PriorityStrategy : public ISchedulingStrategy
+{
+public:
+    static const int PRIORITY_LEVELS = static_cast<int>(TaskPriority::ROOT) + 1;
+
+private:
+    TaskQueue _ready_queues[PRIORITY_LEVELS];
+    uint64_t _ready_bitmap = 0;
+    size_t _ready_count = 0;
+
+    static int level_of(ITaskControlBlock *tcb)
+    {
+        int level = static_cast<int>(tcb->get_resource_config().priority);
+        return level < PRIORITY_LEVELS ? level : PRIORITY_LEVELS - 1;
+    }
+
+public:
+    void make_task_ready(ITaskControlBlock *tcb) override
+    {
+        if (!tcb || !runs_online(tcb))
+            return;
+
+        int level = level_of(tcb);
+        if (!_ready_queues[level].push_back(tcb))
+            return;
+
+        KernelUtils::Bit::set(_ready_bitmap, level);
+        _ready_count++;
+    }
+
+    ITaskControlBlock *pick_next_ready_task() override
+    {
+        // 数值越大优先级越高：取最高置位
+        int level = KernelUtils::Bit::find_last_set(_ready_bitmap);
+        if (level < 0)
+            return nullptr;
+
+        ITaskControlBlock *next = _ready_queues[level].pop_front();
+        if (_ready_queues[level].empty())
+            KernelUtils::Bit::clear(_ready_bitmap, level);
+
+        _ready_count--;
+        return next;
+    }
+
+    ITaskControlBlock *peek_next_ready_task() const override
+    {
+        int level = KernelUtils::Bit::find_last_set(_ready_bitmap);
+        return level < 0 ? nullptr : _ready_queues[level].front();
+    }
+
+    void remove_task(ITaskControlBlock *tcb) override
+    {
+        if (!tcb)
+            return;
+
+        int level = level_of(tcb);
+        if (!_ready_queues[level].remove(tcb))
+            return;
+
+        if (_ready_queues[level].empty())
+            KernelUtils::Bit::clear(_ready_bitmap, level);
+        _ready_count--;
+    }
+
+    /**
+     * @brief 当前最高就绪等级，没有就绪任务时返回 -1（供抢占判断使用）
+     */
+    int highest_ready_level() const
+    {
+        return KernelUtils::Bit::find_last_set(_ready_bitmap);
+    }
+
+    // 就绪任务总数（各等级之和）
+    size_t ready_count() const { return _ready_count; }
+};
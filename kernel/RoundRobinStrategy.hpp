@@ -1,56 +1,36 @@
 #pragma once
 
 #include "ISchedulingStrategy.hpp"
-#include "IObjectBuilder.hpp"
 #include "ITaskControlBlock.hpp"
-#include "KList.hpp"
 
 class RoundRobinStrategy : public ISchedulingStrategy
 {
 private:
-    KList<ITaskControlBlock *> _ready_queue;
+    // 就绪队列直接串联 TCB 内嵌的 sched_link，入队/出队不再经过 Builder 分配节点
+    TaskQueue _ready_queue;
 
 public:
-    RoundRobinStrategy(IObjectBuilder *builder)
-        : _ready_queue(builder)
-    {
-    }
-
     void make_task_ready(ITaskControlBlock *tcb) override
     {
-        if (tcb && !tcb->is_queued())
-        {
-            _ready_queue.push_back(tcb);
-            tcb->set_queued(true); // 必须标记已在队列中
-        }
+        if (!runs_online(tcb))
+            return;
+
+        // 已在队列中的任务会被 push_back 拒绝，不会重复入队
+        _ready_queue.push_back(tcb);
     }
 
     ITaskControlBlock *pick_next_ready_task() override
     {
-        if (_ready_queue.empty())
-            return nullptr;
-
-        auto *next = _ready_queue.front();
-        _ready_queue.pop_front();
-
-        // 出队后必须清除标记，否则它无法再次通过 make_task_ready 入队
-        if (next)
-        {
-            next->set_queued(false);
-        }
+        return _ready_queue.pop_front();
+    }
 
-        return next;
+    ITaskControlBlock *peek_next_ready_task() const override
+    {
+        return _ready_queue.front();
     }
 
     void remove_task(ITaskControlBlock *tcb) override
     {
-        if (tcb && tcb->is_queued())
-        {
-            _ready_queue.remove_match(
-                [tcb](ITaskControlBlock *item)
-                { return item == tcb; });
-
-            tcb->set_queued(false);
-        }
+        _ready_queue.remove(tcb);
     }
-};
\ No newline at end of file
+};
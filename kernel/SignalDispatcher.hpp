@@ -1,6 +1,7 @@
 #pragma once
 
 #include "TaskScheduler.hpp"
+#include "IpcService.hpp"
 #include "ISignal.hpp"
 #include "SignalType.hpp"
 #include <common/diagnostics.hpp>
@@ -9,26 +10,95 @@ struct YieldHandler
 {
     static void handle(TaskScheduler &scheduler, SignalPacket &packet)
     {
-        K_DEBUG("Dispatcher: Handling Yield Signal (ID: %d)", packet.event_id);
-
-        // 核心逻辑委派给调度器
+        // 核心逻辑委派给调度器（热路径，不打印日志）
         scheduler.yield_current();
     }
 };
 
+struct IpcHandler
+{
+    static void handle(IpcService &ipc, SignalEvent op)
+    {
+        // 陷入期间中断被屏蔽：阻塞、移交与唤醒都在这里一次完成
+        switch (op)
+        {
+        case SignalEvent::Block:
+            ipc.on_receive();
+            break;
+        case SignalEvent::Call:
+            ipc.on_call();
+            break;
+        case SignalEvent::Reply:
+            ipc.on_reply();
+            break;
+        case SignalEvent::Wait:
+            ipc.on_wait();
+            break;
+        case SignalEvent::FutexWait:
+            ipc.on_futex_wait();
+            break;
+        case SignalEvent::PublishWait:
+            ipc.on_publish_wait();
+            break;
+        default:
+            break;
+        }
+    }
+};
+
+struct SleepHandler
+{
+    static void handle(TaskScheduler &scheduler)
+    {
+        // 截止时间已暂存在 TCB；已过期时直接返回
+        ITaskControlBlock *current = scheduler.get_current();
+        if (current)
+            scheduler.sleep_current(current->wake_at_ms);
+    }
+};
+
+struct TimerHandler
+{
+    static void handle(TaskScheduler &scheduler, uint32_t tick_ms)
+    {
+        // 时间片记账与抢占判断；可能在此处切走被打断的任务
+        scheduler.on_tick(tick_ms);
+    }
+};
+
 class SignalDispatcher
 {
 public:
-    SignalDispatcher(TaskScheduler &sched) : _sched(sched) {}
+    /**
+     * @param tick_ms 平台时钟中断的周期，用于时间片记账
+     * @param ipc 点对点 IPC 的陷入处理；为空时 IPC 陷入被忽略
+     */
+    SignalDispatcher(TaskScheduler &sched, uint32_t tick_ms = 10, IpcService *ipc = nullptr)
+        : _sched(sched), _tick_ms(tick_ms), _ipc(ipc) {}
 
     void dispatch(SignalPacket &packet)
     {
         switch (packet.type)
         {
         case SignalType::Yield:
-            YieldHandler::handle(_sched, packet);
+            if (is_ipc(packet.event_id))
+            {
+                if (_ipc)
+                    IpcHandler::handle(*_ipc, packet.event_id);
+            }
+            else if (packet.event_id == SignalEvent::Sleep)
+                SleepHandler::handle(_sched);
+            else
+                YieldHandler::handle(_sched, packet);
             break;
         case SignalType::Interrupt:
+            if (packet.event_id == SignalEvent::Timer)
+            {
+                // 先补做推迟的通知唤醒，节拍的抢占判断随即能选中被唤醒者；打断了临界区时再推迟一拍
+                if (_ipc && _sched.is_preemptible())
+                    _ipc->flush_deferred_notifications();
+                TimerHandler::handle(_sched, _tick_ms);
+            }
             // handle_keyboard();
             break;
             // 其他信号...
@@ -36,5 +106,13 @@ public:
     }
 
 private:
+    static bool is_ipc(SignalEvent event)
+    {
+        return event == SignalEvent::Block || event == SignalEvent::Call || event == SignalEvent::Reply ||
+               event == SignalEvent::Wait || event == SignalEvent::FutexWait || event == SignalEvent::PublishWait;
+    }
+
     TaskScheduler &_sched;
+    uint32_t _tick_ms;
+    IpcService *_ipc;
 };
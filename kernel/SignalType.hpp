@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 enum class SignalType
 {
     Interrupt, // 异步脉冲：由外部物理世界或模拟时序产生（不可预测）
@@ -17,7 +19,7 @@ enum class SignalEvent : uint32_t
     Network,
     Disk,
     Power,
-    Sleep,
+    Sleep, // 当前任务睡眠到 TCB 中暂存的 wake_at_ms
     Wakeup,
     Reset,
     Halt,
@@ -27,5 +29,11 @@ enum class SignalEvent : uint32_t
     Resume,
     Pause,
     Yield = 0x71,
-    Terminate = 0x72
+    Terminate = 0x72,
+    Block = 0x73,      // 当前任务等待信箱消息
+    Call = 0x74,       // 同步调用：投递请求并等待回复
+    Reply = 0x75,      // 回复调用方并等待下一条请求
+    Wait = 0x76,       // 等待通知对象的信号位
+    FutexWait = 0x77,  // 地址上的值仍为期望值时睡眠
+    PublishWait = 0x78 // 总线车道已满：等待分发腾出空间
 };
\ No newline at end of file
@@ -10,20 +10,21 @@
  */
 class SimpleTaskControlBlock : public ITaskControlBlock
 {
+public:
+    static constexpr bool SLAB_CACHED = true; // TCB 紧密排列在专属 slab 中
+
 private:
     // 1. 基础属性
     uint32_t _id;
     TaskState _state;
 
-    bool _is_queued = false; // 初始状态不在队列中
-
     // 2. 硬件资源上下文 (注入的执行机制)
     ITaskContext *_context;
     ITaskContextFactory *_ctx_factory;
 
-    // 3. 领域模型 (直接组合)
-    const TaskExecutionInfo &_exec_info;   // 执行意图：去哪跑，带什么参数
-    const TaskResourceConfig &_res_config; // 资源约束：优先级，栈大小
+    // 3. 领域模型 (按值持有：创建参数通常是调用方栈上的临时对象)
+    TaskExecutionInfo _exec_info;   // 执行意图：去哪跑，带什么参数
+    TaskResourceConfig _res_config; // 资源约束：优先级，栈大小
 
 public:
     SimpleTaskControlBlock(
@@ -56,7 +57,4 @@ public:
     TaskState get_state() const override { return _state; }
 
     void set_state(TaskState state) override { _state = state; }
-
-    bool is_queued() const override { return _is_queued; }
-    void set_queued(bool queued) override { _is_queued = queued; }
 };
\ No newline at end of file
@@ -41,5 +41,27 @@ ITaskControlBlock *SimpleTaskFactory::create_tcb(
 
     // 6. 最终封装为 TCB 对象
     // 使用 _builder 构造 TCB，这样 TCB 内部如果需要动态分配内存也能追踪
-    return _builder->construct<SimpleTaskControlBlock>(id, ctx, exec_info, res_config);
+    SimpleTaskControlBlock *tcb = _builder->construct<SimpleTaskControlBlock>(id, ctx, exec_info, res_config);
+    if (!tcb)
+    {
+        _context_factory->destroy_context(ctx);
+        _id_gen->release(id);
+        return nullptr;
+    }
+
+    // 7. 超出内嵌容量的信箱：按配置另行分配槽位，容量非法或内存不足时创建失败
+    uint32_t capacity = res_config.mailbox_capacity;
+    if (capacity > Mailbox::INLINE_CAPACITY)
+    {
+        Message *storage = _builder->construct_array<Message>(capacity);
+        if (!storage || !tcb->mailbox.attach_storage(storage, capacity))
+        {
+            _builder->destroy_array(storage, capacity);
+            _builder->destroy(tcb);
+            _context_factory->destroy_context(ctx);
+            _id_gen->release(id);
+            return nullptr;
+        }
+    }
+    return tcb;
 }
\ No newline at end of file
@@ -1,37 +1,261 @@
 #pragma once
 
+#include <atomic>
+#include <common/diagnostics.hpp>
+
 #include "ITaskControlBlock.hpp"
 #include "ISchedulingStrategy.hpp"
 #include "ISchedulingPolicy.hpp"
+#include "ISchedulingControl.hpp"
+#include "TimerWheel.hpp"
+#include "WaitQueue.hpp"
 
 class TaskScheduler
 {
 public:
+    // 未注入 Policy 时使用的时间片长度
+    static const uint32_t DEFAULT_SLICE_MS = 20;
+
     TaskScheduler(ISchedulingStrategy *strategy, ISchedulingPolicy *policy)
         : _strategy(strategy), _policy(policy) {}
 
+    /**
+     * @brief 主动让出：当前任务归队，由策略重新选择
+     */
     void yield_current()
     {
+        reschedule(false);
+    }
+
+    /**
+     * @brief 时钟节拍：为当前任务记账，时间片耗尽或 Policy 判定应抢占时重新调度
+     * 运行在中断上下文中；若中断打断的是内核临界区，只记下重调度请求，
+     * 由 preempt_enable 在离开临界区时补做
+     * @param elapsed_ms 距上一个节拍经过的时间
+     */
+    void on_tick(uint32_t elapsed_ms)
+    {
+        _tick_count++;
+
+        // 到期的睡眠者进入就绪队列；比当前任务更紧迫时置位重调度请求，下面一并处理
+        // 打断了内核临界区时就绪队列可能正被修改：时间先记账，到下一个节拍再推进
+        _timer_backlog_ms += elapsed_ms;
+        if (_preempt_count == 0)
+        {
+            _timers.advance(_timer_backlog_ms, [this](ITaskControlBlock *task)
+                            { expire(task); });
+            _timer_backlog_ms = 0;
+        }
+
         ITaskControlBlock *current = _current_running;
-        ITaskControlBlock *next = _strategy->pick_next_ready_task();
+        if (!current)
+            return;
 
-        if (!next || next == current)
+        TaskSliceAccount &slice = current->slice;
+        slice.ticks++;
+        slice.remaining_ms = slice.remaining_ms > elapsed_ms ? slice.remaining_ms - elapsed_ms : 0;
+
+        bool expired = slice.remaining_ms == 0;
+        bool preempt = _need_resched; // 唤醒等在中断上下文中发生、尚未兑现的重调度
+        if (!expired && !preempt && _policy)
+        {
+            ITaskControlBlock *next = _strategy->peek_next_ready_task();
+            preempt = next && _policy->should_preempt(current, next);
+        }
+
+        if (!expired && !preempt)
+            return;
+
+        if (_preempt_count > 0)
         {
-            // 没有更合适的任务，继续跑当前任务
+            _need_resched = true;
             return;
         }
 
-        // 1. 状态维护：旧任务归队（Strategy 决定放哪）
-        _strategy->make_task_ready(current);
+        reschedule(true);
+    }
+
+    /**
+     * @brief 阻塞当前任务：不归队，直接切到下一个就绪任务（空闲任务保证总有可选者）
+     * 必须在陷入门内调用；调用方负责在此之前复查等待条件，避免丢失唤醒
+     * @return 没有任何可运行的任务、无法交出 CPU 时返回 false，当前任务维持运行
+     */
+    bool block_current()
+    {
+        return park_current(TaskState::BLOCKED);
+    }
+
+    /**
+     * @brief 把当前任务挂到 queue 上并转入 BLOCKED，直到 wake_one / wake_all 或截止时间到达
+     * 必须在陷入门内调用；调用方负责在此之前复查等待条件，避免丢失唤醒
+     * @param deadline_ms 截止时刻（now_ms 时间轴），0 表示不限时；到期返回时 wait_timed_out 为 true
+     * @return 已过截止时间或无法交出 CPU 时返回 false，当前任务不在队列上、维持运行
+     */
+    bool block_on(WaitQueue &queue, uint64_t deadline_ms = 0)
+    {
+        ITaskControlBlock *current = _current_running;
+        if (!current)
+            return false;
+
+        current->wait_timed_out = deadline_ms && deadline_ms <= _timers.now();
+        if (current->wait_timed_out)
+            return false;
+
+        queue._waiters.push_back(current);
+        if (deadline_ms)
+            _timers.schedule(current, deadline_ms);
+
+        if (park_current(TaskState::BLOCKED))
+            return true;
+
+        queue._waiters.remove(current);
+        _timers.cancel(current);
+        return false;
+    }
+
+    /**
+     * @brief 唤醒最早的等待者，交给 Strategy 归队；比当前任务更紧迫时置位重调度请求
+     * @return 被唤醒的任务；队列为空时返回 nullptr
+     */
+    ITaskControlBlock *wake_one(WaitQueue &queue)
+    {
+        ITaskControlBlock *task = queue._waiters.pop_front();
+        if (!task)
+            return nullptr;
+
+        _timers.cancel(task);
+        make_ready(task);
+        return task;
+    }
+
+    size_t wake_all(WaitQueue &queue)
+    {
+        size_t woken = 0;
+        while (wake_one(queue))
+            woken++;
+        return woken;
+    }
+
+    /**
+     * @brief 睡眠到 deadline_ms（调度器时间，见 now_ms）：挂上时间轮后切走，到期由时钟节拍放回就绪队列
+     * 必须在陷入门内调用
+     * @return 截止时间已过或无法交出 CPU 时返回 false，当前任务维持运行
+     */
+    bool sleep_current(uint64_t deadline_ms)
+    {
+        ITaskControlBlock *current = _current_running;
+        if (!current || deadline_ms <= _timers.now())
+            return false;
+
+        _timers.schedule(current, deadline_ms);
+        if (park_current(TaskState::SLEEPING))
+            return true;
+
+        _timers.cancel(current);
+        return false;
+    }
+
+    /**
+     * @brief 自启动以来由时钟节拍累计的毫秒数
+     */
+    uint64_t now_ms() const { return _timers.now(); }
+
+    // 有任务在睡眠：空闲时不能停掉时钟，否则无人推进时间轮
+    bool has_sleepers() const { return !_timers.empty(); }
+
+    /**
+     * @brief 直接移交（同步 IPC 快速路径）：当前任务阻塞，CPU 不经过就绪队列直接交给阻塞中的 next，
+     * 剩余时间片随控制流一起转移，call / reply 往返共用调用方的同一个时间片
+     * 必须在陷入门内调用
+     * @return 有优先级更高的就绪任务（直接移交会越过它）或 next 并未阻塞时返回 false，
+     * 调用方应退回 wake + block_current 的常规路径
+     */
+    bool handoff(ITaskControlBlock *next)
+    {
+        ITaskControlBlock *current = _current_running;
+        if (!current || !next || next == current || next->get_state() != TaskState::BLOCKED)
+            return false;
+
+        ITaskControlBlock *best = _strategy->peek_next_ready_task();
+        if (best && _policy && _policy->should_preempt(next, best))
+            return false;
+
+        current->set_state(TaskState::BLOCKED);
+        next->set_state(TaskState::READY);
+
+        next->slice.remaining_ms = current->slice.remaining_ms;
+        current->slice.remaining_ms = 0;
+        grant_slice(next);
 
-        // 2. 状态切换：更新当前指针
         _current_running = next;
+        _handoff_count++;
 
-        // 3. 物理执行：触发上下文切换
-        // 注意：这是跨越时空的瞬间
         current->get_context()->transit_to(next->get_context());
+        return true;
+    }
+
+    /**
+     * @brief 唤醒阻塞的任务：重新就绪；若它应当抢占当前任务，则登记重调度请求，
+     * 由发送方离开临界区（PreemptGuard）或下一个节拍兑现，消息送达只需一次切换
+     * @return 任务确实从 BLOCKED 中被唤醒
+     */
+    bool wake(ITaskControlBlock *tcb)
+    {
+        if (!tcb || tcb->get_state() != TaskState::BLOCKED)
+            return false;
+
+        // 也可能挂在某个 WaitQueue 上或在限时等待：一并摘下
+        leave_wait_queue(tcb);
+        _timers.cancel(tcb);
+        make_ready(tcb);
+        return true;
+    }
+
+    /**
+     * @brief 任务销毁前把它从调度器的所有队列上摘下：就绪队列、所在的 WaitQueue 与时间轮，
+     * 此后任何唤醒或定时器到期都不会再让它回到就绪队列
+     * 必须在陷入门或 PreemptGuard 临界区内调用
+     * @return tcb 正是当前运行的任务时返回 false（不能销毁自己所在的执行流）
+     */
+    bool detach(ITaskControlBlock *tcb)
+    {
+        if (!tcb || tcb == _current_running)
+            return false;
+
+        // 就绪队列先经 Strategy 摘除以维护其记账；仍挂着的 sched_link 只可能属于某个 WaitQueue
+        _strategy->remove_task(tcb);
+        leave_wait_queue(tcb);
+        _timers.cancel(tcb);
+        tcb->set_state(TaskState::DEAD);
+        return true;
     }
 
+    /**
+     * @brief 进入/离开内核临界区（可嵌套）
+     * 在任务上下文中执行、且未屏蔽中断的内核代码（例如总线投递）必须包在其中，
+     * 否则时钟中断可能在数据结构修改到一半时切走任务
+     * @return preempt_enable 返回 true 表示临界区内积压了重调度请求，调用方应尽快让出
+     */
+    void preempt_disable()
+    {
+        _preempt_count = _preempt_count + 1;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
+    bool preempt_enable()
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        _preempt_count = _preempt_count - 1;
+        return _preempt_count == 0 && _need_resched;
+    }
+
+    bool is_preemptible() const { return _preempt_count == 0; }
+    bool resched_pending() const { return _need_resched; }
+
+    uint64_t tick_count() const { return _tick_count; }
+    uint64_t preemption_count() const { return _preemption_count; }
+    uint64_t handoff_count() const { return _handoff_count; }
+
     void switch_to(ITaskControlBlock *next)
     {
         if (!next)
@@ -45,7 +269,12 @@ public:
 
         // 2. 更新逻辑状态：谁在跑？
         // 必须在物理切换前更新，因为一旦进入 transit_to，当前函数的执行流就会暂停
+        // 正在运行的任务不应留在就绪队列中；被切走的 prev 仍可运行，归队等待
+        _strategy->remove_task(next);
+        if (prev)
+            _strategy->make_task_ready(prev);
         _current_running = next;
+        grant_slice(next);
 
         K_DEBUG("Scheduler: Context Switch [%s] -> [%s]",
                 prev ? prev->get_name() : "NONE",
@@ -70,11 +299,160 @@ public:
         _current_running = prev;
     }
 
-    void set_current(ITaskControlBlock *tcb) { _current_running = tcb; }
+    void set_current(ITaskControlBlock *tcb)
+    {
+        // 正在运行的任务不在就绪队列中
+        if (tcb)
+        {
+            _strategy->remove_task(tcb);
+            grant_slice(tcb);
+        }
+        _current_running = tcb;
+    }
     ITaskControlBlock *get_current() { return _current_running; }
 
 private:
+    /**
+     * @brief 时间轮到期：限时等待者先从等待队列摘下
+     */
+    void expire(ITaskControlBlock *task)
+    {
+        if (task->get_state() == TaskState::BLOCKED)
+            task->wait_timed_out = leave_wait_queue(task);
+        make_ready(task);
+    }
+
+    /**
+     * @brief 不在就绪队列上的任务，其 sched_link 只可能挂在某个 WaitQueue 上
+     */
+    static bool leave_wait_queue(ITaskControlBlock *task)
+    {
+        if (!task->sched_link.is_linked())
+            return false;
+
+        auto *waiters = static_cast<TaskQueue *>(const_cast<void *>(task->sched_link.owner));
+        return waiters->remove(task);
+    }
+
+    void make_ready(ITaskControlBlock *tcb)
+    {
+        tcb->set_state(TaskState::READY);
+        _strategy->make_task_ready(tcb);
+
+        ITaskControlBlock *current = _current_running;
+        if (current && _policy && _policy->should_preempt(current, tcb))
+            _need_resched = true;
+    }
+
+    /**
+     * @brief 当前任务转入 state 并切到下一个就绪任务，不归队
+     */
+    bool park_current(TaskState state)
+    {
+        ITaskControlBlock *current = _current_running;
+        if (!current)
+            return false;
+
+        ITaskControlBlock *next = _strategy->pick_next_ready_task();
+        if (!next)
+        {
+            K_WARN("Scheduler: [%s] cannot block, no runnable task", current->get_name());
+            return false;
+        }
+
+        _need_resched = false;
+        current->set_state(state);
+        _current_running = next;
+        grant_slice(next);
+
+        current->get_context()->transit_to(next->get_context());
+        return true;
+    }
+
+    void reschedule(bool involuntary)
+    {
+        ITaskControlBlock *current = _current_running;
+        if (!current)
+            return;
+
+        _need_resched = false;
+
+        // 1. 状态维护：旧任务先归队（Strategy 决定放哪），
+        // 使策略在包含当前任务的就绪集合中做决策：优先级策略下，更高优先级的当前任务会被重新选中
+        _strategy->make_task_ready(current);
+        ITaskControlBlock *next = _strategy->pick_next_ready_task();
+
+        if (!next || next == current)
+        {
+            // 没有更合适的任务，继续跑当前任务（它已被重新出队）
+            grant_slice(current);
+            return;
+        }
+
+        if (involuntary)
+        {
+            current->slice.preemptions++;
+            _preemption_count++;
+        }
+
+        // 2. 状态切换：更新当前指针
+        _current_running = next;
+        grant_slice(next);
+
+        // 3. 物理执行：触发上下文切换
+        // 注意：这是跨越时空的瞬间
+        current->get_context()->transit_to(next->get_context());
+    }
+
+    /**
+     * 时间片只在耗尽后重新发放：被高优先级任务抢占的任务回来时继续用完剩余部分
+     */
+    void grant_slice(ITaskControlBlock *tcb)
+    {
+        if (tcb->slice.remaining_ms == 0)
+            tcb->slice.remaining_ms = _policy ? _policy->get_time_slice_ms(tcb) : DEFAULT_SLICE_MS;
+    }
+
     ITaskControlBlock *_current_running = nullptr;
     ISchedulingStrategy *_strategy;
     ISchedulingPolicy *_policy;
+    TimerWheel _timers;
+    uint32_t _timer_backlog_ms = 0; // 临界区内到达的节拍尚未推进的时间
+
+    // 与中断处理程序共享（同一宿主线程上的信号），用 volatile 防止编译器缓存
+    volatile uint32_t _preempt_count = 0;
+    volatile bool _need_resched = false;
+
+    uint64_t _tick_count = 0;
+    uint64_t _preemption_count = 0;
+    uint64_t _handoff_count = 0;
+};
+
+/**
+ * PreemptGuard: 内核临界区的 RAII 封装
+ * 离开临界区时若积压了重调度请求，经由平台陷入门让出（陷入期间中断被屏蔽，调度器不会被重入）；
+ * 因此在临界区内唤醒了更高优先级的任务（send、notify、futex_wake 等）时，离开临界区即切换过去
+ */
+class PreemptGuard
+{
+private:
+    TaskScheduler *_sched;
+    ISchedulingControl *_ctrl;
+
+public:
+    PreemptGuard(TaskScheduler *sched, ISchedulingControl *ctrl)
+        : _sched(sched), _ctrl(ctrl)
+    {
+        if (_sched)
+            _sched->preempt_disable();
+    }
+
+    ~PreemptGuard()
+    {
+        if (_sched && _sched->preempt_enable() && _ctrl)
+            _ctrl->yield_current_task();
+    }
+
+    PreemptGuard(const PreemptGuard &) = delete;
+    PreemptGuard &operator=(const PreemptGuard &) = delete;
 };
\ No newline at end of file
@@ -2,27 +2,48 @@
 
 #include "ITaskLifecycle.hpp"
 #include "ISchedulingStrategy.hpp"
+#include "TaskScheduler.hpp"
+#include "BufferGrantTable.hpp"
 #include "IMessageBus.hpp"
 #include "MessageCallback.hpp"
+#include <common/diagnostics.hpp>
+
+/**
+ * 任务放置汇总：由 TaskService::placement_stats 遍历全部任务得到
+ */
+struct TaskPlacementStats
+{
+    uint32_t tasks = 0;
+    uint32_t pinned = 0; // 亲和性只含一个 CPU 的任务
+};
 
 class TaskService
 {
+public:
+    static const CpuMask ONLINE_CPUS = CPU_MASK_ONLINE;
+
 private:
     ITaskLifecycle *_lifecycle;     // 负责“生”和“死”
     ISchedulingStrategy *_strategy; // 负责“在哪排队”
     IMessageBus *_message_bus;      // 负责“沟通”
+    TaskScheduler *_scheduler;      // 可选：销毁任务时把它从等待队列与时间轮上摘下
+    BufferGrantTable *_grants;      // 可选：销毁任务时回收它持有的缓冲授权
 
     ITaskControlBlock *_root_task = nullptr;
     ITaskControlBlock *_idle_task = nullptr;
 
+    uint32_t _rejected_spawns = 0;
+
 public:
     TaskService(ITaskLifecycle *lifecycle,
                 ISchedulingStrategy *strategy,
-                IMessageBus *bus)
-        : _lifecycle(lifecycle), _strategy(strategy), _message_bus(bus)
+                IMessageBus *bus,
+                TaskScheduler *scheduler = nullptr,
+                BufferGrantTable *grants = nullptr)
+        : _lifecycle(lifecycle), _strategy(strategy), _message_bus(bus), _scheduler(scheduler), _grants(grants)
     {
         // 初始化时订阅任务创建请求
-        _message_bus->subscribe(MessageType::SYS_LOAD_TASK, BIND_MESSAGE_CB(TaskService, handle_spawn_request, this));
+        _message_bus->subscribe_channel<TaskSpawnChannel, TaskService, &TaskService::handle_spawn_request>(this);
     }
 
     /**
@@ -42,6 +63,7 @@ public:
 
     /**
      * @brief 遍历系统中所有存在的任务（包括就绪、阻塞或运行中）
+     * 访问者可读取每个任务的运行统计：时间片记账 (slice) 与亲和性 (get_resource_config().affinity)
      */
     void inspect_all_tasks(ITaskVisitor &visitor) const
     {
@@ -52,23 +74,61 @@ public:
     }
 
     /**
-     * 业务处理逻辑：从消息解析意图
+     * @brief 汇总所有任务的亲和性：总数与绑定到单个 CPU 的任务数
+     */
+    TaskPlacementStats placement_stats() const
+    {
+        struct Collector : ITaskVisitor
+        {
+            TaskPlacementStats stats;
+
+            void visit(ITaskControlBlock *tcb) override
+            {
+                CpuMask affinity = tcb->get_resource_config().affinity;
+                stats.tasks++;
+                stats.pinned += affinity && !(affinity & (affinity - 1)) ? 1 : 0;
+            }
+        } collector;
+
+        inspect_all_tasks(collector);
+        return collector.stats;
+    }
+
+    uint32_t rejected_spawn_count() const { return _rejected_spawns; }
+
+    /**
+     * 业务处理逻辑：TaskSpawnChannel 的处理函数，载荷已由总线从授权中取出
      */
-    void handle_spawn_request(const Message &msg)
+    void handle_spawn_request(const TaskSpawnParams &params)
     {
-        auto *params = reinterpret_cast<const TaskSpawnParams *>(msg.payload);
+        spawn(params);
+    }
+
+    /**
+     * @brief 创建任务并放入调度器
+     * 亲和性与在线 CPU 取交集后随 TCB 保存；交集为空的任务无处可跑，拒绝创建
+     * @return 被拒绝或创建失败时返回 nullptr
+     */
+    ITaskControlBlock *spawn(const TaskSpawnParams &params)
+    {
+        TaskResourceConfig res = params.res_config;
+        res.affinity &= ONLINE_CPUS;
+        if (!res.affinity)
+        {
+            _rejected_spawns++;
+            K_WARN("TaskService: affinity 0x%x excludes every online CPU, spawn rejected", params.res_config.affinity);
+            return nullptr;
+        }
 
         // 1. 调用 Lifecycle 创建物理实体
-        // 我们可以直接把整个 params 传进去，或者拆开传
-        ITaskControlBlock *tcb = _lifecycle->spawn_task(
-            params->exec_info,
-            params->res_config);
+        ITaskControlBlock *tcb = _lifecycle->spawn_task(params.exec_info, res);
 
         if (tcb)
         {
             // 2. 放入调度器
             _strategy->make_task_ready(tcb);
         }
+        return tcb;
     }
     /**
      * 优雅退出业务
@@ -79,12 +139,56 @@ public:
             return;
 
         ITaskControlBlock *tcb = _lifecycle->get_task(task_id);
-        if (tcb)
+        if (!tcb)
+            return;
+
+        // 从调度中移除：阻塞或睡眠中的任务还挂在等待队列或时间轮上，须一并摘下
+        if (_scheduler)
+        {
+            if (!_scheduler->detach(tcb))
+                return;
+        }
+        else
         {
-            // 从调度算法中移除
             _strategy->remove_task(tcb);
-            // 回收资源
-            _lifecycle->destroy_task(tcb);
         }
+
+        // 等待它回复的调用方不会再收到回复：带着失败返回，避免在复用的 ID 上永远阻塞
+        release_callers(task_id);
+
+        // 回收资源：未释放的授权引用归还共享池，其他持有者不受影响
+        if (_grants)
+            _grants->release_all(task_id);
+        _lifecycle->destroy_task(tcb);
+    }
+
+private:
+    /**
+     * @brief 唤醒所有阻塞在 call 上、等待 server_id 回复的任务，ipc.ok 置为 false
+     * 阻塞只能经由调度器发生：没有调度器时不存在这样的任务
+     */
+    void release_callers(uint32_t server_id)
+    {
+        if (!_scheduler)
+            return;
+
+        struct Releaser : ITaskVisitor
+        {
+            TaskScheduler *scheduler;
+            uint32_t server_id;
+
+            void visit(ITaskControlBlock *tcb) override
+            {
+                if (tcb->ipc.wait != IpcWait::Reply || tcb->ipc.partner != server_id)
+                    return;
+                tcb->ipc.ok = false;
+                tcb->ipc.wait = IpcWait::None;
+                scheduler->wake(tcb);
+            }
+        } releaser;
+        releaser.scheduler = _scheduler;
+        releaser.server_id = server_id;
+
+        _lifecycle->enumerate_tasks(releaser);
     }
 };
\ No newline at end of file
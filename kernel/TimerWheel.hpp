@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "ITaskControlBlock.hpp"
+
+/**
+ * TimerWheel: 分层时间轮（毫秒分辨率），由平台时钟节拍推进
+ * - LEVELS 层，每层 SLOTS 个槽；第 l 层一个槽覆盖 SLOTS^l 毫秒，可直接落槽的最远距离为 SPAN
+ * - 定时器挂钩嵌在 TCB 内 (timer_link)：插入只按距离算出层与槽后链入，取消按挂钩所属链表摘除，均为 O(1)
+ * - 每推进一毫秒处理第 0 层的当前槽；低位进位时把高层当前槽的任务重新落到更低层（级联）
+ * - 超出 SPAN 的截止时间先挂在最高层，级联时再按真实截止时间重新落槽
+ *
+ * 只在时钟中断或陷入门内访问，不加锁
+ */
+class TimerWheel
+{
+public:
+    static const uint32_t LEVELS = 4;
+    static const uint32_t SLOT_BITS = 6;
+    static const uint32_t SLOTS = 1u << SLOT_BITS;
+    static const uint64_t SPAN = 1ull << (LEVELS * SLOT_BITS);
+
+    typedef IntrusiveList<ITaskControlBlock, &ITaskControlBlock::timer_link> TimerQueue;
+
+private:
+    static const uint64_t SLOT_MASK = SLOTS - 1;
+
+    TimerQueue _wheel[LEVELS][SLOTS];
+    uint64_t _now = 0;
+    size_t _count = 0;
+
+public:
+    TimerWheel() = default;
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    uint64_t now() const { return _now; }
+    size_t size() const { return _count; }
+    bool empty() const { return _count == 0; }
+
+    /**
+     * @brief 在 deadline（绝对毫秒）到期时交给 advance 的回调；已在轮上的任务先取消
+     * 不晚于当前时刻的截止时间按下一毫秒处理
+     */
+    void schedule(ITaskControlBlock *task, uint64_t deadline)
+    {
+        cancel(task);
+        task->wake_at_ms = deadline > _now ? deadline : _now + 1;
+        place(task);
+        _count++;
+    }
+
+    bool cancel(ITaskControlBlock *task)
+    {
+        TimerQueue *queue = queue_of(task);
+        if (!queue)
+            return false;
+
+        queue->remove(task);
+        _count--;
+        return true;
+    }
+
+    /**
+     * @brief 推进 elapsed 毫秒，逐个交出到期任务
+     * @param on_expire void(ITaskControlBlock *)；回调中可以重新 schedule
+     */
+    template <typename F>
+    void advance(uint64_t elapsed, F &&on_expire)
+    {
+        // 轮上没有任务时直接拨动时间
+        if (_count == 0)
+        {
+            _now += elapsed;
+            return;
+        }
+
+        while (elapsed--)
+        {
+            _now++;
+
+            // 低位全零的各层自高向低级联，保证降级的任务在本毫秒内仍能被处理
+            uint32_t top = 0;
+            while (top + 1 < LEVELS && (_now & ((1ull << (SLOT_BITS * (top + 1))) - 1)) == 0)
+                top++;
+            for (uint32_t level = top; level > 0; --level)
+                cascade(level);
+
+            TimerQueue &due = _wheel[0][_now & SLOT_MASK];
+            while (ITaskControlBlock *task = due.pop_front())
+            {
+                _count--;
+                on_expire(task);
+            }
+        }
+    }
+
+private:
+    void place(ITaskControlBlock *task)
+    {
+        uint64_t delta = task->wake_at_ms > _now ? task->wake_at_ms - _now : 0;
+        if (delta >= SPAN)
+            delta = SPAN - 1;
+
+        uint32_t level = 0;
+        while (level + 1 < LEVELS && delta >= (1ull << (SLOT_BITS * (level + 1))))
+            level++;
+
+        uint64_t at = _now + delta;
+        _wheel[level][(at >> (SLOT_BITS * level)) & SLOT_MASK].push_back(task);
+    }
+
+    void cascade(uint32_t level)
+    {
+        TimerQueue &slot = _wheel[level][(_now >> (SLOT_BITS * level)) & SLOT_MASK];
+        for (size_t n = slot.size(); n > 0; --n)
+            place(slot.pop_front());
+    }
+
+    TimerQueue *queue_of(ITaskControlBlock *task)
+    {
+        const void *owner = task->timer_link.owner;
+        if (owner < static_cast<const void *>(&_wheel[0][0]) || owner > static_cast<const void *>(&_wheel[LEVELS - 1][SLOTS - 1]))
+            return nullptr;
+        return static_cast<TimerQueue *>(const_cast<void *>(owner));
+    }
+};
@@ -0,0 +1,330 @@
+#pragma once
+#include "IAllocator.hpp"
+#include "KernelUtils.hpp"
+
+/**
+ * TlsfHeapAllocator: 两级分离适配堆 (Two-Level Segregated Fit)
+ * - 一级 (FL) 按 2 的幂划分尺寸区间，二级 (SL) 把每个区间再均分为 16 档
+ * - 两级位图 + 位扫描直接定位非空空闲链表，allocate / deallocate 均为 O(1)
+ * - 块头记录物理前驱（边界标记），释放时与相邻空闲块常数时间合并
+ */
+class TlsfHeapAllocator : public IAllocator
+{
+private:
+    template <typename>
+    friend class HeapInspector;
+
+    static const size_t ALIGN_SIZE_LOG2 = 4;
+    static const size_t ALIGN_SIZE = 1ULL << ALIGN_SIZE_LOG2; // 有效载荷对齐 16 字节
+
+    static const size_t SL_INDEX_COUNT_LOG2 = 4;
+    static const size_t SL_INDEX_COUNT = 1ULL << SL_INDEX_COUNT_LOG2;
+
+    // 小于 SMALL_BLOCK_SIZE 的块全部落在 FL=0，按 16 字节线性分档
+    static const size_t FL_INDEX_SHIFT = SL_INDEX_COUNT_LOG2 + ALIGN_SIZE_LOG2;
+    static const size_t FL_INDEX_MAX = 40; // 单块上限 1TB
+    static const size_t FL_INDEX_COUNT = FL_INDEX_MAX - FL_INDEX_SHIFT + 1;
+    static const size_t SMALL_BLOCK_SIZE = 1ULL << FL_INDEX_SHIFT;
+
+    // size 字段低位的状态标记（块尺寸总是 16 的倍数）
+    static const size_t BLOCK_FREE = 0x1;
+    static const size_t BLOCK_PREV_FREE = 0x2;
+    static const size_t BLOCK_FLAGS = BLOCK_FREE | BLOCK_PREV_FREE;
+
+    struct BlockHeader
+    {
+        BlockHeader *prev_phys; // 物理前驱，仅在前驱空闲时有效
+        size_t size;            // 有效载荷大小 | 状态标记
+
+        // 以下字段仅在块空闲时有效，与有效载荷重叠
+        BlockHeader *next_free;
+        BlockHeader *prev_free;
+    };
+
+    // 已分配块的头部开销：prev_phys + size
+    static const size_t BLOCK_OVERHEAD = sizeof(BlockHeader *) + sizeof(size_t);
+    // 有效载荷至少能容纳空闲链表指针
+    static const size_t BLOCK_SIZE_MIN = sizeof(BlockHeader) - BLOCK_OVERHEAD;
+    static const size_t BLOCK_SIZE_MAX = (1ULL << FL_INDEX_MAX) - ALIGN_SIZE;
+
+    uint64_t _fl_bitmap = 0;
+    uint64_t _sl_bitmap[FL_INDEX_COUNT] = {};
+    BlockHeader *_blocks[FL_INDEX_COUNT][SL_INDEX_COUNT] = {};
+
+    BlockHeader *_first_block = nullptr;
+
+public:
+    /**
+     * @param start 堆的起始线性地址
+     * @param size  堆的总大小
+     */
+    TlsfHeapAllocator(void *start, size_t size)
+    {
+        uintptr_t begin = KernelUtils::Align::up(reinterpret_cast<uintptr_t>(start), ALIGN_SIZE);
+        uintptr_t end = KernelUtils::Align::down(reinterpret_cast<uintptr_t>(start) + size, ALIGN_SIZE);
+
+        // 至少要放下：首块头 + 最小载荷 + 尾哨兵
+        if (end <= begin || end - begin < 2 * BLOCK_OVERHEAD + BLOCK_SIZE_MIN)
+            return;
+
+        size_t payload = end - begin - 2 * BLOCK_OVERHEAD;
+        if (payload > BLOCK_SIZE_MAX)
+            payload = BLOCK_SIZE_MAX;
+
+        _first_block = reinterpret_cast<BlockHeader *>(begin);
+        _first_block->prev_phys = nullptr;
+        _first_block->size = payload | BLOCK_FREE;
+
+        // 尾哨兵：零长度的“已用”块，保证 next_phys 永远不越界
+        BlockHeader *sentinel = next_phys(_first_block);
+        sentinel->prev_phys = _first_block;
+        sentinel->size = BLOCK_PREV_FREE;
+
+        insert_free_block(_first_block);
+    }
+
+    void *allocate(size_t size, size_t alignment = 8) override
+    {
+        if (size > BLOCK_SIZE_MAX)
+            return nullptr;
+
+        size_t adjusted = KernelUtils::Align::up(size < BLOCK_SIZE_MIN ? BLOCK_SIZE_MIN : size, ALIGN_SIZE);
+
+        // 超过 16 字节的对齐需求：多申请一段，稍后把前部空隙切成独立空闲块
+        size_t gap_reserve = alignment > ALIGN_SIZE ? alignment + sizeof(BlockHeader) : 0;
+
+        BlockHeader *block = search_suitable_block(adjusted + gap_reserve);
+        if (!block)
+            return nullptr;
+
+        remove_free_block(block);
+
+        if (gap_reserve)
+            block = trim_leading(block, alignment);
+
+        trim_trailing(block, adjusted);
+        mark_used(block);
+
+        return to_ptr(block);
+    }
+
+    void deallocate(void *ptr, size_t size) override
+    {
+        if (!ptr)
+            return;
+
+        BlockHeader *block = from_ptr(ptr);
+        block->size |= BLOCK_FREE;
+
+        BlockHeader *next = next_phys(block);
+        next->prev_phys = block;
+        next->size |= BLOCK_PREV_FREE;
+
+        // 1. 与物理前驱合并
+        if (block->size & BLOCK_PREV_FREE)
+        {
+            BlockHeader *prev = block->prev_phys;
+            remove_free_block(prev);
+            set_size(prev, block_size(prev) + BLOCK_OVERHEAD + block_size(block));
+            block = prev;
+            next->prev_phys = block;
+        }
+
+        // 2. 与物理后继合并
+        if (next->size & BLOCK_FREE)
+        {
+            remove_free_block(next);
+            set_size(block, block_size(block) + BLOCK_OVERHEAD + block_size(next));
+            next_phys(block)->prev_phys = block;
+        }
+
+        insert_free_block(block);
+    }
+
+private:
+    // --- 块操作 ---
+
+    static size_t block_size(const BlockHeader *block)
+    {
+        return block->size & ~BLOCK_FLAGS;
+    }
+
+    static void set_size(BlockHeader *block, size_t size)
+    {
+        block->size = size | (block->size & BLOCK_FLAGS);
+    }
+
+    static void *to_ptr(BlockHeader *block)
+    {
+        return reinterpret_cast<uint8_t *>(block) + BLOCK_OVERHEAD;
+    }
+
+    static BlockHeader *from_ptr(void *ptr)
+    {
+        return reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(ptr) - BLOCK_OVERHEAD);
+    }
+
+    static BlockHeader *next_phys(BlockHeader *block)
+    {
+        return reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(to_ptr(block)) + block_size(block));
+    }
+
+    static void mark_used(BlockHeader *block)
+    {
+        block->size &= ~BLOCK_FREE;
+        next_phys(block)->size &= ~BLOCK_PREV_FREE;
+    }
+
+    /**
+     * 把块前部的空隙切成独立空闲块，使有效载荷满足 alignment
+     * 调用方已多申请 alignment + sizeof(BlockHeader)，切分后剩余部分一定够用
+     */
+    BlockHeader *trim_leading(BlockHeader *block, size_t alignment)
+    {
+        uintptr_t ptr = reinterpret_cast<uintptr_t>(to_ptr(block));
+        uintptr_t aligned = KernelUtils::Align::up(ptr, alignment);
+
+        if (aligned == ptr)
+            return block;
+
+        // 空隙必须能容纳一个最小空闲块
+        if (aligned - ptr < sizeof(BlockHeader))
+            aligned = KernelUtils::Align::up(ptr + sizeof(BlockHeader), alignment);
+
+        size_t gap = aligned - ptr;
+        BlockHeader *remaining = from_ptr(reinterpret_cast<void *>(aligned));
+        remaining->size = (block_size(block) - gap) | BLOCK_FREE | BLOCK_PREV_FREE;
+        remaining->prev_phys = block;
+        next_phys(remaining)->prev_phys = remaining;
+
+        set_size(block, gap - BLOCK_OVERHEAD);
+        insert_free_block(block);
+
+        return remaining;
+    }
+
+    /**
+     * 若块尾部还能容纳一个最小块，则切出并归还空闲链表
+     * 原块即将被标记为已用，切出的块不可能再与后继合并（后继必然已用）
+     */
+    void trim_trailing(BlockHeader *block, size_t size)
+    {
+        if (block_size(block) < size + sizeof(BlockHeader))
+            return;
+
+        BlockHeader *remaining = reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(to_ptr(block)) + size);
+        remaining->size = (block_size(block) - size - BLOCK_OVERHEAD) | BLOCK_FREE;
+        remaining->prev_phys = block;
+        next_phys(remaining)->prev_phys = remaining;
+
+        set_size(block, size);
+        insert_free_block(remaining);
+    }
+
+    // --- 尺寸映射 ---
+
+    static void mapping_insert(size_t size, int &fl, int &sl)
+    {
+        if (size < SMALL_BLOCK_SIZE)
+        {
+            fl = 0;
+            sl = static_cast<int>(size / (SMALL_BLOCK_SIZE / SL_INDEX_COUNT));
+        }
+        else
+        {
+            int bit = KernelUtils::Bit::find_last_set(size);
+            sl = static_cast<int>((size >> (bit - SL_INDEX_COUNT_LOG2)) ^ SL_INDEX_COUNT);
+            fl = bit - static_cast<int>(FL_INDEX_SHIFT - 1);
+        }
+    }
+
+    /**
+     * 向上取整到下一档，保证该档链表中任意块都能满足请求
+     */
+    static void mapping_search(size_t size, int &fl, int &sl)
+    {
+        if (size >= SMALL_BLOCK_SIZE)
+            size += (1ULL << (KernelUtils::Bit::find_last_set(size) - SL_INDEX_COUNT_LOG2)) - 1;
+        mapping_insert(size, fl, sl);
+    }
+
+    BlockHeader *search_suitable_block(size_t size)
+    {
+        int fl, sl;
+        mapping_search(size, fl, sl);
+        if (fl >= static_cast<int>(FL_INDEX_COUNT))
+            return nullptr;
+
+        // 1. 同一级区间内，查找不小于 sl 的非空档
+        uint64_t sl_map = _sl_bitmap[fl] & (~0ULL << sl);
+        if (!sl_map)
+        {
+            // 2. 否则退到更高的一级区间
+            uint64_t fl_map = _fl_bitmap & (~0ULL << (fl + 1));
+            if (!fl_map)
+                return nullptr;
+
+            fl = KernelUtils::Bit::find_first_set(fl_map);
+            sl_map = _sl_bitmap[fl];
+        }
+
+        sl = KernelUtils::Bit::find_first_set(sl_map);
+        return _blocks[fl][sl];
+    }
+
+    // --- 空闲链表 ---
+
+    void insert_free_block(BlockHeader *block)
+    {
+        int fl, sl;
+        mapping_insert(block_size(block), fl, sl);
+
+        BlockHeader *head = _blocks[fl][sl];
+        block->next_free = head;
+        block->prev_free = nullptr;
+        if (head)
+            head->prev_free = block;
+        _blocks[fl][sl] = block;
+
+        KernelUtils::Bit::set(_fl_bitmap, fl);
+        KernelUtils::Bit::set(_sl_bitmap[fl], sl);
+    }
+
+    void remove_free_block(BlockHeader *block)
+    {
+        int fl, sl;
+        mapping_insert(block_size(block), fl, sl);
+
+        if (block->next_free)
+            block->next_free->prev_free = block->prev_free;
+        if (block->prev_free)
+            block->prev_free->next_free = block->next_free;
+
+        if (_blocks[fl][sl] == block)
+        {
+            _blocks[fl][sl] = block->next_free;
+            if (!_blocks[fl][sl])
+            {
+                KernelUtils::Bit::clear(_sl_bitmap[fl], sl);
+                if (!_sl_bitmap[fl])
+                    KernelUtils::Bit::clear(_fl_bitmap, fl);
+            }
+        }
+    }
+
+    // --- 诊断 ---
+
+    /**
+     * 按物理顺序遍历所有块（不含尾哨兵），f 形如 void(size_t size, bool used)
+     */
+    template <typename F>
+    void for_each_block(F f) const
+    {
+        BlockHeader *curr = _first_block;
+        while (curr && block_size(curr) != 0)
+        {
+            f(block_size(curr), !(curr->size & BLOCK_FREE));
+            curr = next_phys(curr);
+        }
+    }
+};
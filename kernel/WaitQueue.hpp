@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ITaskControlBlock.hpp"
+
+class TaskScheduler;
+
+/**
+ * WaitQueue: 等待某个事件的任务队列（先进先出）
+ * - 等待者经 TCB 内嵌的 sched_link 挂入：BLOCKED 的任务不在就绪队列上，挂钩空闲，入队/出队不分配
+ * - 阻塞与唤醒只经 TaskScheduler::block_on / wake_one / wake_all，被唤醒者交给 ISchedulingStrategy 归队；
+ *   带截止时间的等待到期时由调度器把任务从队列摘下，并置位 wait_timed_out
+ *
+ * 与就绪队列相同，只在陷入门、时钟中断或 PreemptGuard 临界区内访问
+ */
+class WaitQueue
+{
+    friend class TaskScheduler;
+
+private:
+    TaskQueue _waiters;
+
+public:
+    WaitQueue() = default;
+    WaitQueue(const WaitQueue &) = delete;
+    WaitQueue &operator=(const WaitQueue &) = delete;
+
+    bool empty() const { return _waiters.empty(); }
+    size_t size() const { return _waiters.size(); }
+    bool contains(ITaskControlBlock *task) const { return _waiters.contains(task); }
+
+    /**
+     * @brief 按等待顺序遍历；回调中可以经 TaskScheduler::wake 唤醒当前元素
+     */
+    template <typename F>
+    void for_each(F func)
+    {
+        _waiters.for_each(func);
+    }
+};
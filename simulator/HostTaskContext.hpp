@@ -0,0 +1,14 @@
+#pragma once
+
+// 按宿主平台选择具体的上下文实现，供基准/测试等平台无关代码使用
+#ifdef _WIN32
+#include "WinTaskContext.hpp"
+#include "WinTaskContextFactory.hpp"
+using HostTaskContext = WinTaskContext;
+using HostTaskContextFactory = WinTaskContextFactory;
+#else
+#include "LinuxTaskContext.hpp"
+#include "LinuxTaskContextFactory.hpp"
+using HostTaskContext = LinuxTaskContext;
+using HostTaskContextFactory = LinuxTaskContextFactory;
+#endif
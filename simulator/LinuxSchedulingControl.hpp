@@ -0,0 +1,44 @@
+#pragma once
+
+#include <kernel/ISchedulingControl.hpp>
+#include <kernel/SignalType.hpp>
+#include "PosixSignalGate.hpp"
+
+class LinuxSchedulingControl : public ISchedulingControl
+{
+private:
+    PosixSignalGate *_dispatcher; // 持有分发器引用
+
+public:
+    LinuxSchedulingControl(PosixSignalGate *dispatcher)
+        : _dispatcher(dispatcher)
+    {
+    }
+
+    void yield_current_task() override
+    {
+        // 主动触发一个 Yield 类型的信号，ID 约定为 Yield
+        _dispatcher->trigger_manual_signal(SignalType::Yield, SignalEvent::Yield);
+    }
+
+    void block_current_task() override
+    {
+        // 是否真正阻塞由内核在陷入后（中断屏蔽时）复查信箱决定
+        _dispatcher->trigger_manual_signal(SignalType::Yield, SignalEvent::Block);
+    }
+
+    void invoke_ipc(SignalEvent op) override
+    {
+        _dispatcher->trigger_manual_signal(SignalType::Yield, op);
+    }
+
+    void terminate_current_task() override
+    {
+        // 所有任务共享同一个宿主线程，不能像 Win32 后端那样直接退出线程。
+        // 已结束的任务不断让出执行权，直到内核将其回收。
+        while (true)
+        {
+            _dispatcher->trigger_manual_signal(SignalType::Yield, SignalEvent::Terminate);
+        }
+    }
+};
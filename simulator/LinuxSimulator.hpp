@@ -0,0 +1,166 @@
+#pragma once
+#include <common/ZImg.hpp>
+#include <common/BootInfo.hpp>
+#include <kernel/Memory.hpp>
+#include "kernel/Kernel.hpp"
+
+#include "LinuxTaskContextFactory.hpp"
+#include "PosixSignalGate.hpp"
+#include "PosixTickSource.hpp"
+#include "PosixWakeEvent.hpp"
+#include "LinuxSchedulingControl.hpp"
+#include <kernel/PlatformHooks.hpp>
+#include "LoggerLinux.hpp"
+#include <thread>
+#include <cstdlib>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <time.h>
+#include <common/DisplayRegs.hpp>
+
+extern "C" void kmain(PhysicalMemoryLayout layout,
+                      BootInfo info,
+                      PlatformHooks *platform_hooks);
+
+extern ISchedulingControl *g_platform_sched_ctrl;
+
+void load_os_image(const char *filename, PhysicalMemoryLayout layout, BootInfo *out_info);
+PhysicalMemoryLayout reserve_kernel_arena(PhysicalMemoryLayout layout, const BootInfo &info);
+
+// 模拟器内存初始化：匿名映射，需可执行以承载 RootTask 的扁平二进制
+PhysicalMemoryLayout setup_memory(size_t size)
+{
+    PhysicalMemoryLayout layout;
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    layout.base = (base == MAP_FAILED) ? nullptr : base;
+    layout.size = (base == MAP_FAILED) ? 0 : size;
+    return layout;
+}
+
+// 模拟时钟：中断送往内核线程
+PosixTickSource g_tick_source;
+pid_t g_kernel_tid = 0;
+
+// 空闲唤醒事件：总线投递时由内核通知
+PosixWakeEvent g_idle_event;
+
+void LinuxStartTimer(uint32_t period_ms)
+{
+    g_tick_source.start(g_kernel_tid, period_ms);
+}
+
+void LinuxStopTimer()
+{
+    g_tick_source.stop();
+}
+
+void LinuxWaitForEvent(uint32_t timeout_ms)
+{
+    g_idle_event.wait(timeout_ms);
+}
+
+void LinuxNotifyEvent()
+{
+    g_idle_event.notify();
+}
+
+uint64_t LinuxMonotonicUs()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000ull + static_cast<uint64_t>(ts.tv_nsec) / 1000;
+}
+
+// 空闲等待：先打开中断再睡眠，时钟中断会提前唤醒（相当于 sti; hlt）
+void LinuxHalt()
+{
+    PosixSignalGate::enable_interrupts();
+    usleep(10 * 1000);
+}
+
+// 模拟物理显存
+const int VRAM_WIDTH = 1080;
+const int VRAM_HEIGHT = 720;
+DisplayRegs g_gpu_regs = {VRAM_WIDTH, VRAM_HEIGHT, VRAM_WIDTH * 4, 32, 0, 0};
+uint32_t g_physical_vram[VRAM_WIDTH * VRAM_HEIGHT];
+
+// 无窗口环境：设置 ZK_FRAMEBUFFER_DUMP=<path> 时把显存导出为 PPM 文件，否则不做任何事
+// PPM 只能整帧写出，脏矩形在这里不起作用
+void LinuxRefreshDisplay(const DirtyRect &)
+{
+    static const char *dump_path = std::getenv("ZK_FRAMEBUFFER_DUMP");
+    if (!dump_path)
+        return;
+
+    FILE *f = std::fopen(dump_path, "wb");
+    if (!f)
+        return;
+
+    std::fprintf(f, "P6\n%d %d\n255\n", VRAM_WIDTH, VRAM_HEIGHT);
+    for (int i = 0; i < VRAM_WIDTH * VRAM_HEIGHT; i++)
+    {
+        uint32_t px = g_physical_vram[i];
+        unsigned char rgb[3] = {(unsigned char)(px >> 16), (unsigned char)(px >> 8), (unsigned char)px};
+        std::fwrite(rgb, 1, sizeof(rgb), f);
+    }
+    std::fclose(f);
+}
+
+void run_simulator()
+{
+    // --- 初始化模拟内存 ---
+    PhysicalMemoryLayout layout = setup_memory(128 * 1024 * 1024);
+    if (!layout.base)
+    {
+        std::fprintf(stderr, "[Simulator] Failed to map physical memory.\n");
+        return;
+    }
+
+    BootInfo info{};
+    load_os_image(IMG_PATH, layout, &info);
+
+    // 内核只管理镜像下方的内存，避免引导分配覆盖 RootTask
+    PhysicalMemoryLayout kernel_arena = reserve_kernel_arena(layout, info);
+
+    // 创建并填充资源账本
+    static ResourceManager res_manager;
+
+    // 注册显示器控制寄存器 (模拟 MMIO 空间)
+    res_manager.register_hw("DISPLAY_REGS", (uintptr_t)&g_gpu_regs, sizeof(g_gpu_regs));
+
+    // 注册线性显存
+    res_manager.register_hw("DISPLAY_LFB", (uintptr_t)g_physical_vram, sizeof(g_physical_vram));
+
+    // ---  创建内核线程 ---
+    // 宿主线程即模拟 CPU：内核与所有任务都在这条线程上通过上下文切换轮转
+    std::thread kernel_thread([&]()
+                              {
+        auto* signal_dispatcher = new PosixSignalGate();
+        signal_dispatcher->set_target_thread(pthread_self());
+        g_kernel_tid = gettid();
+        auto* sched_control = new LinuxSchedulingControl(signal_dispatcher);
+        g_platform_sched_ctrl = sched_control;
+
+        PlatformHooks hooks{};
+        hooks.dispatcher = signal_dispatcher;
+        hooks.sched_control = sched_control;
+        hooks.task_context_factory = new LinuxTaskContextFactory();
+        hooks.halt = LinuxHalt;
+        hooks.start_timer = LinuxStartTimer;
+        hooks.stop_timer = LinuxStopTimer;
+        if (g_idle_event.is_valid())
+        {
+            hooks.wait_for_event = LinuxWaitForEvent;
+            hooks.notify_event = LinuxNotifyEvent;
+        }
+        hooks.monotonic_us = LinuxMonotonicUs;
+        hooks.refresh_display = LinuxRefreshDisplay;
+        hooks.resource_manager = &res_manager;
+
+        // 进入 kmain，这会启动 RootTask
+        kmain(kernel_arena, info, &hooks); });
+
+    // 无窗口消息循环：宿主主线程只负责等待内核线程
+    kernel_thread.join();
+}
@@ -0,0 +1,116 @@
+#include "LinuxTaskContext.hpp"
+#include <cstring>
+#include <kernel/ISchedulingControl.hpp>
+#include "PosixSignalGate.hpp"
+
+extern "C" void context_switch_asm(void **old_sp, void *new_sp);
+extern "C" void context_start_trampoline();
+extern "C" void context_exit_trampoline();
+
+extern "C" void platform_task_start_stub()
+{
+    // 首次切入可能发生在时钟中断处理程序内部（中断仍被屏蔽），任务必须以中断开启的状态起步
+    PosixSignalGate::enable_interrupts();
+}
+
+void platform_task_exit_stub()
+{
+    // 任务入口函数返回后经由 context_exit_trampoline 对齐栈再进入这里
+    extern ISchedulingControl *g_platform_sched_ctrl;
+    g_platform_sched_ctrl->terminate_current_task();
+}
+
+LinuxTaskContext::LinuxTaskContext(void *exit_stub)
+{
+    if (exit_stub)
+    {
+        this->_exit_stub = exit_stub;
+    }
+    else
+    {
+        this->_exit_stub = reinterpret_cast<void *>(platform_task_exit_stub);
+    }
+}
+
+void LinuxTaskContext::transit_to(ITaskContext *target)
+{
+    auto *next_ctx = static_cast<LinuxTaskContext *>(target);
+
+    // 第一个参数 (RDI): 当前 sp 成员变量的地址 (&this->sp)
+    // 第二个参数 (RSI): 目标 sp 的值 (next_ctx->sp)
+    context_switch_asm(reinterpret_cast<void **>(&this->sp), next_ctx->sp);
+}
+
+size_t LinuxTaskContext::get_context_size() const
+{
+    return sizeof(LinuxX64Regs);
+}
+
+void LinuxTaskContext::setup_flow(void (*entry)(void *, void *), void *stack_top)
+{
+    this->entry_func = reinterpret_cast<void *>(entry);
+    this->stack_top = stack_top;
+
+    this->setup_registers();
+}
+
+void LinuxTaskContext::setup_registers()
+{
+    uintptr_t curr = reinterpret_cast<uintptr_t>(this->stack_top);
+    curr &= ~0xFULL; // 强制 16 字节对齐 (16n)
+
+    // 1. 填充槽，保持后续布局的对齐关系
+    curr -= 8;
+    *reinterpret_cast<uintptr_t *>(curr) = 0;
+
+    // 2. 退出桩地址 (数据)：由 context_exit_trampoline 读取
+    curr -= 8;
+    *reinterpret_cast<uintptr_t *>(curr) = reinterpret_cast<uintptr_t>(_exit_stub);
+
+    // 3. 返回地址：入口函数 ret 之后落入跳板
+    // 此时的 curr 满足 curr % 16 == 8，即进入入口函数时 RSP = 16n + 8
+    curr -= 8;
+    *reinterpret_cast<uintptr_t *>(curr) = reinterpret_cast<uintptr_t>(context_exit_trampoline);
+
+    // 4. 启动跳板 (RIP)，给 context_switch_asm 最后的 ret 使用；真正的入口经 R12 转交
+    curr -= 8;
+    *reinterpret_cast<uintptr_t *>(curr) = reinterpret_cast<uintptr_t>(context_start_trampoline);
+
+    // 5. 寄存器镜像区
+    curr -= sizeof(LinuxX64Regs);
+    this->sp = reinterpret_cast<LinuxX64Regs *>(curr);
+
+    memset(this->sp, 0, sizeof(LinuxX64Regs));
+    this->sp->r12 = reinterpret_cast<uintptr_t>(this->entry_func);
+
+    // 6. 刷入参数
+    update_regs_from_args();
+}
+
+void LinuxTaskContext::load_argument(size_t index, uintptr_t value)
+{
+    if (index >= 4)
+        return; // 防止越界
+
+    // 1. 暂存在数组中
+    m_args[index] = value;
+
+    // 2. 如果 sp 已经 setup_flow 好了，直接同步到内存镜像
+    if (this->sp)
+    {
+        update_regs_from_args();
+    }
+}
+
+// 辅助函数：将数组值刷入寄存器镜像
+void LinuxTaskContext::update_regs_from_args()
+{
+    if (!this->sp)
+        return;
+
+    // 映射关系：0->RDI, 1->RSI, 2->RDX, 3->RCX
+    this->sp->rdi = m_args[0];
+    this->sp->rsi = m_args[1];
+    this->sp->rdx = m_args[2];
+    this->sp->rcx = m_args[3];
+}
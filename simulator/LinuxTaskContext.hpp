@@ -0,0 +1,45 @@
+#pragma once
+#include <kernel/ITaskContext.hpp>
+#include <cstdint>
+#include "LinuxX64Regs.hpp"
+
+class LinuxTaskContext : public ITaskContext
+{
+private:
+    // sp 指向栈上保存 LinuxX64Regs 结构体的位置
+    LinuxX64Regs *sp = nullptr;
+
+    // System V 前 6 个整型参数使用寄存器 (RDI, RSI, RDX, RCX, R8, R9)
+    // 与 Win32 后端保持一致，这里支持前 4 个
+    uintptr_t m_args[4] = {0, 0, 0, 0};
+
+    void *entry_func = nullptr;
+    void *stack_top = nullptr;
+
+    void *_exit_stub = nullptr;
+
+    void update_regs_from_args();
+
+public:
+    LinuxTaskContext() : LinuxTaskContext(nullptr) {}
+    // 构造函数：System V 没有影子空间，只需要退出桩
+    explicit LinuxTaskContext(void *exit_stub);
+
+    size_t get_context_size() const override;
+
+    /**
+     * 核心动作：从当前执行流切换到另一个执行流
+     * @param target 目标上下文
+     * 内部实现：保存当前寄存器到 this，从 target 恢复寄存器并跳转
+     */
+    void transit_to(ITaskContext *target) override;
+
+    void load_argument(size_t index, uintptr_t value) override;
+
+    void setup_flow(void (*entry)(void *, void *), void *stack_top) override;
+
+    void *get_stack_pointer() const override { return sp; }
+
+private:
+    void setup_registers();
+};
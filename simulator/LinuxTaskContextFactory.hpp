@@ -0,0 +1,22 @@
+#pragma once
+
+#include "kernel/ITaskContextFactory.hpp"
+#include "LinuxTaskContext.hpp"
+
+// 位于模拟器工程，直接依赖具体的 LinuxTaskContext
+class LinuxTaskContextFactory : public ITaskContextFactory
+{
+public:
+    LinuxTaskContextFactory() = default;
+
+    ITaskContext *create_context() override
+    {
+        // 直接在模拟器堆上创建具体对象
+        return new LinuxTaskContext();
+    }
+
+    void destroy_context(ITaskContext *ctx) override
+    {
+        delete ctx;
+    }
+};
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+
+#pragma pack(push, 1)
+struct LinuxX64Regs
+{
+    // --- 参数寄存器（用于首航参数传递，System V: RDI, RSI, RDX, RCX） ---
+    // 偏移 0x00: 物理地址最低，RSP 指向这里
+    uint64_t rdi;
+    uint64_t rsi;
+    uint64_t rdx;
+    uint64_t rcx;
+
+    // --- 非易失性寄存器（System V 下 Callee-saved 的全部整数寄存器） ---
+    uint64_t rbp;
+    uint64_t rbx;
+    uint64_t r12;
+    uint64_t r13;
+    uint64_t r14;
+    uint64_t r15;
+};
+#pragma pack(pop)
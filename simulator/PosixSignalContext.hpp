@@ -0,0 +1,46 @@
+#pragma once
+
+#include <ucontext.h>
+#include <cstdint>
+
+#include "kernel/ISignal.hpp"
+
+class PosixSignalContext : public ISignalContext
+{
+private:
+    // 存储宿主信号处理或 getcontext 获取到的原始现场快照
+    ucontext_t _context;
+
+public:
+    explicit PosixSignalContext(const ucontext_t &ctx) : _context(ctx) {}
+
+    /**
+     * @brief 获取指令指针 (PC/IP)
+     */
+    uintptr_t get_instruction_pointer() const override
+    {
+        return static_cast<uintptr_t>(_context.uc_mcontext.gregs[REG_RIP]);
+    }
+
+    /**
+     * @brief 获取栈指针 (SP)
+     */
+    uintptr_t get_stack_pointer() const override
+    {
+        return static_cast<uintptr_t>(_context.uc_mcontext.gregs[REG_RSP]);
+    }
+
+    /**
+     * @brief 设置通用返回值寄存器 (通常用于系统调用)
+     * System V 下返回值存储在 RAX
+     */
+    void set_return_value(uintptr_t value) override
+    {
+        _context.uc_mcontext.gregs[REG_RAX] = static_cast<greg_t>(value);
+    }
+
+    /**
+     * @brief 获取原始 ucontext
+     */
+    const ucontext_t &get_raw_context() const { return _context; }
+};
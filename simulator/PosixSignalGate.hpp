@@ -0,0 +1,135 @@
+#pragma once
+
+#include <pthread.h>
+#include <signal.h>
+#include <atomic>
+#include <iostream>
+
+#include <kernel/ISignal.hpp>
+#include <kernel/SignalType.hpp>
+#include "PosixSignalContext.hpp"
+
+/**
+ * PosixSignalGate: 用宿主 POSIX 信号模拟中断线路
+ *
+ * - 同步信号 (Yield/Terminate)：在当前线程上直接调用内核监听者，
+ *   期间屏蔽中断信号，相当于陷入门自动清除 IF。
+ * - 异步中断：通过 pthread_sigqueue 向目标线程（内核线程）投递实时信号，
+ *   向量号随 sigval 携带，在目标线程被打断的现场上分发给内核。
+ */
+class PosixSignalGate : public ISignalGate
+{
+private:
+    ISignalListener *_listener = nullptr;
+    pthread_t _target_thread{}; // 被模拟的 CPU 线程（内核与所有任务所在的线程）
+    bool _has_target = false;
+    std::atomic<bool> _active{false};
+
+    // 宿主信号处理函数只能是静态的，这里记录唯一的门实例
+    static inline PosixSignalGate *s_instance = nullptr;
+
+public:
+    // 模拟中断线使用的宿主实时信号
+    static int interrupt_signal() { return SIGRTMIN; }
+
+    /**
+     * @brief 在当前线程上打开中断（解除中断信号屏蔽），相当于 sti
+     * 中断处理程序内发生的任务切换会把“屏蔽”状态带进下一个任务，
+     * 因此新任务首次启动与空闲等待前都需要显式打开
+     */
+    static void enable_interrupts()
+    {
+        sigset_t irq_set;
+        sigemptyset(&irq_set);
+        sigaddset(&irq_set, interrupt_signal());
+        pthread_sigmask(SIG_UNBLOCK, &irq_set, nullptr);
+    }
+
+    // 注入运行内核的线程
+    void set_target_thread(pthread_t thread_handle)
+    {
+        _target_thread = thread_handle;
+        _has_target = true;
+    }
+
+    void bind_listener(ISignalListener *listener) override
+    {
+        _listener = listener;
+    }
+
+    void activate() override
+    {
+        s_instance = this;
+
+        struct sigaction sa = {};
+        sa.sa_sigaction = &PosixSignalGate::on_host_signal;
+        sa.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+        sigaction(interrupt_signal(), &sa, nullptr);
+
+        _active = true;
+        std::cout << "[Posix SignalGate] Signals Activated." << std::endl;
+    }
+
+    void deactivate() override
+    {
+        _active = false;
+        std::cout << "[Posix SignalGate] Signals Deactivated." << std::endl;
+    }
+
+    /**
+     * @brief 模拟硬件指令触发信号
+     * 由 LinuxSchedulingControl 调用，运行在发起请求的任务上下文中
+     */
+    void trigger_manual_signal(SignalType type, SignalEvent event_id)
+    {
+        // 1. 进入内核：屏蔽异步中断，防止内核数据结构被重入
+        sigset_t irq_set, saved_set;
+        sigemptyset(&irq_set);
+        sigaddset(&irq_set, interrupt_signal());
+        pthread_sigmask(SIG_BLOCK, &irq_set, &saved_set);
+
+        // 2. 捕获当前任务的瞬时现场
+        ucontext_t uc;
+        getcontext(&uc);
+
+        // 3. 包装并分发给内核监听者
+        PosixSignalContext sig_ctx(uc);
+        SignalPacket packet{type, event_id, &sig_ctx};
+
+        // _listener 是通过 bind_listener 绑定的 Kernel
+        _listener->on_signal_received(packet);
+
+        // 4. 返回任务：恢复进入前的中断屏蔽状态
+        pthread_sigmask(SIG_SETMASK, &saved_set, nullptr);
+    }
+
+    /**
+     * @brief 模拟物理中断触发
+     * 可以由任意宿主线程（例如定时器线程）调用，中断最终在目标线程上处理
+     */
+    void trigger_interrupt(SignalEvent vector)
+    {
+        if (!_active || !_listener || !_has_target)
+            return;
+
+        union sigval value;
+        value.sival_int = static_cast<int>(vector);
+        pthread_sigqueue(_target_thread, interrupt_signal(), value);
+    }
+
+private:
+    static void on_host_signal(int, siginfo_t *info, void *raw_context)
+    {
+        PosixSignalGate *gate = s_instance;
+        if (!gate || !gate->_active || !gate->_listener)
+            return;
+
+        // 被打断一瞬间的现场由宿主内核提供
+        PosixSignalContext signal_ctx(*static_cast<ucontext_t *>(raw_context));
+
+        auto vector = static_cast<SignalEvent>(info->si_value.sival_int);
+        SignalPacket packet{SignalType::Interrupt, vector, &signal_ctx};
+        gate->_listener->on_signal_received(packet);
+    }
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <signal.h>
+#include <time.h>
+#include <sys/types.h>
+#include <iostream>
+
+#include <kernel/SignalType.hpp>
+#include "PosixSignalGate.hpp"
+
+// 旧版 glibc 头文件未导出该字段名
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+/**
+ * PosixTickSource: 模拟可编程定时器 (PIT/LAPIC Timer)
+ *
+ * 使用 POSIX 定时器直接向内核线程投递中断信号 (SIGEV_THREAD_ID)，
+ * 向量号固定为 SignalEvent::Timer，与 PosixSignalGate::trigger_interrupt 的投递方式一致，
+ * 无需额外的宿主线程。
+ */
+class PosixTickSource
+{
+private:
+    timer_t _timer{};
+    bool _created = false;
+    bool _armed = false;
+    uint32_t _period_ms = 0;
+
+public:
+    ~PosixTickSource()
+    {
+        if (_created)
+            timer_delete(_timer);
+    }
+
+    /**
+     * @param target_tid 内核线程的宿主线程 ID (gettid)
+     * @param period_ms 节拍周期；定时器已在运行时只调整周期
+     */
+    bool start(pid_t target_tid, uint32_t period_ms)
+    {
+        if (period_ms == 0)
+            return false;
+
+        if (!_created)
+        {
+            struct sigevent sev = {};
+            sev.sigev_notify = SIGEV_THREAD_ID;
+            sev.sigev_signo = PosixSignalGate::interrupt_signal();
+            sev.sigev_value.sival_int = static_cast<int>(SignalEvent::Timer);
+            sev.sigev_notify_thread_id = target_tid;
+
+            if (timer_create(CLOCK_MONOTONIC, &sev, &_timer) != 0)
+            {
+                std::cerr << "[Posix TickSource] timer_create failed." << std::endl;
+                return false;
+            }
+            _created = true;
+            std::cout << "[Posix TickSource] Timer armed: " << period_ms << " ms." << std::endl;
+        }
+
+        if (_armed && _period_ms == period_ms)
+            return true;
+
+        struct itimerspec spec = {};
+        spec.it_interval.tv_sec = period_ms / 1000;
+        spec.it_interval.tv_nsec = static_cast<long>(period_ms % 1000) * 1000000L;
+        spec.it_value = spec.it_interval;
+
+        if (timer_settime(_timer, 0, &spec, nullptr) != 0)
+            return false;
+
+        _armed = true;
+        _period_ms = period_ms;
+        return true;
+    }
+
+    /**
+     * @brief 停止节拍（tickless 空闲期间），定时器对象保留以便快速重启
+     */
+    void stop()
+    {
+        if (!_armed)
+            return;
+
+        struct itimerspec spec = {};
+        timer_settime(_timer, 0, &spec, nullptr);
+        _armed = false;
+    }
+
+    bool is_armed() const { return _armed; }
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstdint>
+
+#include "PosixSignalGate.hpp"
+
+/**
+ * PosixWakeEvent: 空闲等待/唤醒原语，基于 eventfd
+ *
+ * - notify: 计数器加一，可在信号处理程序中调用（write 是异步信号安全的）
+ * - wait:   打开中断后 poll 阻塞；通知、中断信号 (EINTR，poll 不受 SA_RESTART 影响) 或超时都会返回。
+ *           先于 wait 发生的通知留在计数器里，不会丢失
+ */
+class PosixWakeEvent
+{
+private:
+    int _fd = -1;
+
+public:
+    PosixWakeEvent()
+    {
+        _fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    }
+
+    ~PosixWakeEvent()
+    {
+        if (_fd >= 0)
+            close(_fd);
+    }
+
+    PosixWakeEvent(const PosixWakeEvent &) = delete;
+    PosixWakeEvent &operator=(const PosixWakeEvent &) = delete;
+
+    bool is_valid() const { return _fd >= 0; }
+
+    void notify()
+    {
+        uint64_t one = 1;
+        ssize_t written = write(_fd, &one, sizeof(one));
+        (void)written;
+    }
+
+    /**
+     * @param timeout_ms 0 表示不设超时
+     * @return 是否因通知而返回
+     */
+    bool wait(uint32_t timeout_ms)
+    {
+        PosixSignalGate::enable_interrupts();
+
+        struct pollfd pfd = {};
+        pfd.fd = _fd;
+        pfd.events = POLLIN;
+
+        int ready = poll(&pfd, 1, timeout_ms ? static_cast<int>(timeout_ms) : -1);
+        if (ready <= 0)
+            return false;
+
+        // 清零计数器：多次通知合并为一次唤醒
+        uint64_t count = 0;
+        ssize_t got = read(_fd, &count, sizeof(count));
+        return got == sizeof(count);
+    }
+};
@@ -20,6 +20,7 @@ extern "C" void kmain(PhysicalMemoryLayout layout,
 extern ISchedulingControl *g_platform_sched_ctrl;
 
 void load_os_image(const char *filename, PhysicalMemoryLayout layout, BootInfo *out_info);
+PhysicalMemoryLayout reserve_kernel_arena(PhysicalMemoryLayout layout, const BootInfo &info);
 
 // 模拟器内存初始化
 PhysicalMemoryLayout setup_memory(size_t size)
@@ -80,12 +81,13 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 const char *G_WND_CLASS = "Gemini_OS_Monitor";
 HWND g_hMonitorWnd = NULL;
 
-void MyWin32Refresh()
+void MyWin32Refresh(const DirtyRect &dirty)
 {
     if (g_hMonitorWnd)
     {
-        // 这是真实的 Win32 API
-        InvalidateRect(g_hMonitorWnd, NULL, FALSE);
+        // 只让脏区域失效，WM_PAINT 时由系统裁剪重绘
+        RECT rect = {(LONG)dirty.x, (LONG)dirty.y, (LONG)(dirty.x + dirty.width), (LONG)(dirty.y + dirty.height)};
+        InvalidateRect(g_hMonitorWnd, dirty.is_full() ? NULL : &rect, FALSE);
     }
 }
 
@@ -96,6 +98,9 @@ void run_simulator()
     BootInfo info;
     load_os_image(IMG_PATH, layout, &info);
 
+    // 内核只管理镜像下方的内存，避免引导分配覆盖 RootTask
+    PhysicalMemoryLayout kernel_arena = reserve_kernel_arena(layout, info);
+
     // 创建并填充资源账本
     static ResourceManager res_manager;
 
@@ -115,16 +120,34 @@ void run_simulator()
         auto* sched_control = new Win32SchedulingControl(signal_dispatcher);
         g_platform_sched_ctrl = sched_control;
 
-        PlatformHooks hooks;
+        PlatformHooks hooks{}; // Win32 后端暂无时钟源 (start_timer 为空)，保持协作调度
         hooks.dispatcher = signal_dispatcher;
         hooks.sched_control = sched_control;
         hooks.task_context_factory = new WinTaskContextFactory();
         hooks.halt = []() { Sleep(10); }; // 模拟时钟挂起
+
+        // 空闲等待/唤醒：自动复位事件，先于等待的 SetEvent 不会丢失
+        static HANDLE s_idle_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+        if (s_idle_event)
+        {
+            hooks.wait_for_event = [](uint32_t timeout_ms)
+            { WaitForSingleObject(s_idle_event, timeout_ms ? timeout_ms : INFINITE); };
+            hooks.notify_event = []()
+            { SetEvent(s_idle_event); };
+        }
+        hooks.monotonic_us = []() -> uint64_t
+        {
+            static LARGE_INTEGER freq = []()
+            { LARGE_INTEGER f; QueryPerformanceFrequency(&f); return f; }();
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            return static_cast<uint64_t>(now.QuadPart) * 1000000ull / static_cast<uint64_t>(freq.QuadPart);
+        };
         hooks.refresh_display = MyWin32Refresh;
         hooks.resource_manager = &res_manager;
 
         // 进入 kmain，这会启动 RootTask
-        kmain(layout, info, &hooks); });
+        kmain(kernel_arena, info, &hooks); });
     kernel_thread.detach(); // 让内核独立运行
 
     // ---  宿主主线程：创建 Win32 窗口 ---
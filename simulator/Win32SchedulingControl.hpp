@@ -26,6 +26,16 @@ public:
         _dispatcher->trigger_manual_signal(SignalType::Yield, SignalEvent::Yield);
     }
 
+    void block_current_task() override
+    {
+        _dispatcher->trigger_manual_signal(SignalType::Yield, SignalEvent::Block);
+    }
+
+    void invoke_ipc(SignalEvent op) override
+    {
+        _dispatcher->trigger_manual_signal(SignalType::Yield, op);
+    }
+
     void terminate_current_task() override
     {
         // 1. 主动触发一个 Yield 类型的信号，ID 约定为 Terminate
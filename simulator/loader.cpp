@@ -7,8 +7,15 @@
 #include <kernel/Memory.hpp>
 #include <common/BootInfo.hpp>
 
+// 段表镜像：BootInfo::sections_table 指向这里，供内核/模拟器查询镜像占用的物理区域
+static const uint32_t MAX_IMAGE_SECTIONS = 16;
+static ZImgSection g_loaded_sections[MAX_IMAGE_SECTIONS];
+
 void load_os_image(const char *path, PhysicalMemoryLayout layout, BootInfo *info)
 {
+    info->extra_sections_count = 0;
+    info->sections_table = g_loaded_sections;
+
     std::ifstream f(path, std::ios::binary);
     if (!f)
     {
@@ -31,6 +38,9 @@ void load_os_image(const char *path, PhysicalMemoryLayout layout, BootInfo *info
         ZImgSection sec;
         f.read((char *)&sec, sizeof(ZImgSection));
 
+        if (info->extra_sections_count < MAX_IMAGE_SECTIONS)
+            g_loaded_sections[info->extra_sections_count++] = sec;
+
         // 暂存段表位置，跳转到数据区
         std::streampos next_sec_ptr = f.tellg();
         f.seekg(sec.file_offset);
@@ -79,4 +89,21 @@ void load_os_image(const char *path, PhysicalMemoryLayout layout, BootInfo *info
     info->memory_size = layout.size;
     f.close();
     std::cout << "[Loader] Image loaded successfully." << std::endl;
-}
\ No newline at end of file
+}
+
+/**
+ * 计算内核可用的引导内存：从物理基址到最低的已加载段为止
+ * StaticLayoutAllocator 从基址线性向上分配，若不截断会覆盖镜像内容
+ */
+PhysicalMemoryLayout reserve_kernel_arena(PhysicalMemoryLayout layout, const BootInfo &info)
+{
+    size_t limit = layout.size;
+    for (uint32_t i = 0; i < info.extra_sections_count; ++i)
+    {
+        size_t start = (size_t)info.sections_table[i].dest_phys_addr;
+        if (start < limit)
+            limit = start;
+    }
+
+    return PhysicalMemoryLayout{layout.base, limit};
+}
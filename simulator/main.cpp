@@ -1,8 +1,12 @@
-#include <windows.h>
 #include <iostream>
 #include <fstream>
 
+#ifdef _WIN32
+#include <windows.h>
 #include "Simulator.hpp"
+#else
+#include "LinuxSimulator.hpp"
+#endif
 
 int main()
 {
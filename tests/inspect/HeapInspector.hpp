@@ -1,14 +1,17 @@
 #pragma once
 
 #include <kernel/KernelHeapAllocator.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
 
 /**
  * @brief 堆状态检查员（实例对象版）
+ * @tparam Heap 被透视的具体分配器类型，需提供私有的 for_each_block
  */
+template <typename Heap>
 class HeapInspector
 {
 private:
-    KernelHeapAllocator *_target;
+    Heap *_target;
 
 public:
     /**
@@ -17,11 +20,11 @@ public:
     explicit HeapInspector(IAllocator *alloc)
     {
         // 将基类指针强转为友元类识别的具体实现类
-        _target = static_cast<KernelHeapAllocator *>(alloc);
+        _target = static_cast<Heap *>(alloc);
     }
 
     /**
-     * @brief 实时遍历链表，统计总剩余空间
+     * @brief 实时遍历块链，统计总剩余空间
      */
     size_t get_free_size() const
     {
@@ -29,16 +32,10 @@ public:
             return 0;
 
         size_t total_free = 0;
-        auto *curr = _target->_first_block; // 直接访问私有成员
-
-        while (curr)
-        {
-            if (!curr->is_used)
-            {
-                total_free += curr->size;
-            }
-            curr = curr->next;
-        }
+        _target->for_each_block([&](size_t size, bool used)
+                                {
+            if (!used)
+                total_free += size; });
         return total_free;
     }
 
@@ -51,31 +48,21 @@ public:
             return 0;
 
         size_t total_used = 0;
-        auto *curr = _target->_first_block;
-
-        while (curr)
-        {
-            if (curr->is_used)
-            {
-                total_used += curr->size;
-            }
-            curr = curr->next;
-        }
+        _target->for_each_block([&](size_t size, bool used)
+                                {
+            if (used)
+                total_used += size; });
         return total_used;
     }
 
     /**
-     * @brief 获取链表中的块总数（用于分析碎片化程度）
+     * @brief 获取块总数（用于分析碎片化程度）
      */
     size_t get_block_count() const
     {
         size_t count = 0;
-        auto *curr = _target->_first_block;
-        while (curr)
-        {
-            count++;
-            curr = curr->next;
-        }
+        _target->for_each_block([&](size_t, bool)
+                                { count++; });
         return count;
     }
-};
\ No newline at end of file
+};
@@ -29,10 +29,16 @@ public:
     IAllocator *heap() const { return _kernel->_runtime_heap; }
     IObjectBuilder *builder() const { return _kernel->_builder; }
     ISchedulingStrategy *strategy() const { return _kernel->_strategy; }
+    TaskScheduler *scheduler() const { return _kernel->_task_scheduler; }
+    IpcService *ipc() const { return _kernel->_ipc; }
+    BufferGrantTable *grants() const { return _kernel->_grants; }
     ISchedulingControl *control() const { return _kernel->_platform_hooks->sched_control; }
 
     ITaskContextFactory *context_factory() const { return _kernel->_platform_hooks->task_context_factory; }
 
+    // 任务放置汇总：CPU 亲和性与迁移次数
+    TaskPlacementStats placement_stats() const { return _kernel->_task_service->placement_stats(); }
+
     /**
      * @brief 核心查询方法：基于 ID 检查任务是否运行过
      */
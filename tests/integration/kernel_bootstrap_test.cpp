@@ -2,19 +2,41 @@
 #include "test_framework.hpp"
 
 #include "unit/test_klist.hpp"
-#include "unit/test_simulator_core.hpp" // 假设也有这个
+#include "unit/test_intrusive_list.hpp"
+#include "unit/test_priority_strategy.hpp"
+#include "unit/test_preemption.hpp"
+#include "unit/test_tlsf_heap.hpp"
+#include "unit/test_slab_cache.hpp"
 #include "unit/test_zimg.hpp"
-#include "unit/test_abi_frames.hpp"
 #include "unit/test_message_system.hpp"
+#include "unit/test_mpsc_ring.hpp"
+#include "unit/test_mailbox.hpp"
+#include "unit/test_ipc_call.hpp"
+#include "unit/test_buffer_grant.hpp"
+#include "unit/test_channel.hpp"
+#include "unit/test_notification.hpp"
+#include "unit/test_stream_ring.hpp"
+#include "unit/test_timer_wheel.hpp"
+#include "unit/test_wait_queue.hpp"
+#include "unit/test_futex.hpp"
 #include "unit/test_task_factory.hpp"
 #include "unit/test_task_creation_integrity.hpp"
 #include "unit/test_bootstrap.hpp"
+
+#ifdef _WIN32
+#include "unit/test_simulator_core.hpp" // 假设也有这个
+#include "unit/test_abi_frames.hpp"
 #include "unit/test_context_jump_and_abi_integrity.hpp"
+#else
+#include "unit/test_linux_abi_frames.hpp"
+#include "unit/test_linux_context_jump.hpp"
+#endif
 
 // --- 基础引导与协议层 ---
 K_TEST_CASE(unit_test_compact_pe_loading, "Compact PE Entry");
 K_TEST_CASE(unit_test_zimg_header_integrity, "ZImg Protocol Integrity");
 
+#ifdef _WIN32
 // --- 模拟器与硬件抽象层 (HAL) ---
 K_TEST_CASE(unit_test_simulator_context_abi, "Simulator: Context ABI Integrity");
 K_TEST_CASE(unit_test_simulator_memory_layout, "Simulator: Physical Memory Map");
@@ -22,11 +44,49 @@ K_TEST_CASE(unit_test_simulator_memory_layout, "Simulator: Physical Memory Map")
 // --- 架构与 ABI 契约 ---
 K_TEST_CASE(unit_test_shadow_space_and_alignment_contract, "ABI: Shadow Space & Alignment");
 K_TEST_CASE(unit_test_context_switch_lifecycle, "ABI: Context Jump & ABI Integrity");
+#else
+// --- 模拟器与硬件抽象层 (HAL)：System V 后端 ---
+K_TEST_CASE(unit_test_sysv_context_abi, "Simulator: SysV Context ABI Integrity");
+K_TEST_CASE(unit_test_sysv_context_switch_lifecycle, "ABI: SysV Context Jump & Exit Stub");
+#endif
 
 // --- 核心领域模型 (Unit Contracts) ---
 K_TEST_CASE(unit_test_klist_allocation, "[Step 1] Running Unit Contract: KList");
+K_TEST_CASE(unit_test_intrusive_list_basic, "IntrusiveList: Link/Unlink Contract");
+K_TEST_CASE(unit_test_round_robin_intrusive_queue, "RoundRobin: Allocation-Free Ready Queue");
+K_TEST_CASE(unit_test_priority_strategy_ordering, "PriorityStrategy: Bitmap & Per-Level FIFO");
+K_TEST_CASE(unit_test_priority_yield_keeps_higher_task, "PriorityStrategy: Yield Keeps Higher Task");
+K_TEST_CASE(unit_test_preemption_slice_rotation, "Preemption: Time Slice Expiry Rotation");
+K_TEST_CASE(unit_test_preemption_priority_and_guard, "Preemption: Priority Preempt & Critical Section");
+K_TEST_CASE(unit_test_timer_wheel_expiry, "TimerWheel: Hierarchical Expiry & Cancel");
+K_TEST_CASE(unit_test_scheduler_sleep, "Scheduler: Sleep Until Deadline");
+K_TEST_CASE(unit_test_wait_queue_block_wake, "WaitQueue: Block, Wake & Timed Wait");
+K_TEST_CASE(unit_test_task_kill_detaches, "TaskService: Kill Detaches Tasks & Releases Grants");
+K_TEST_CASE(unit_test_futex_wait_wake, "Futex: Hashed Wait/Wake & User-Space Fast Path");
+K_TEST_CASE(unit_test_tlsf_heap_alloc_free_coalesce, "TLSF Heap: Alloc/Free & Coalescing");
+K_TEST_CASE(unit_test_tlsf_heap_exhaustion_and_reuse, "TLSF Heap: Exhaustion & Reuse");
+K_TEST_CASE(unit_test_slab_cache_routing, "Slab Cache: Per-Type Routing & Reclaim");
+K_TEST_CASE(unit_test_slab_cache_list_nodes, "Slab Cache: KList Nodes");
 K_TEST_CASE(unit_test_task_factory_integrity, "[Step 2] Task Factory: Dependency Injection");
 K_TEST_CASE(unit_test_message_system_integrity, "[Step 3] MessageBus: Pub-Sub Flow");
+K_TEST_CASE(unit_test_message_dispatch_table, "MessageBus: Dense Dispatch Table");
+K_TEST_CASE(unit_test_mpsc_ring_bounds, "MpscRing: Bounds & FIFO");
+K_TEST_CASE(unit_test_mpsc_ring_stress, "MpscRing: Multi-Producer Stress");
+K_TEST_CASE(unit_test_message_bus_concurrent_publish, "MessageBus: Concurrent Host Publish");
+K_TEST_CASE(unit_test_message_bus_wakeup, "MessageBus: Publish Wakeup & Pending State");
+K_TEST_CASE(unit_test_message_bus_batch, "MessageBus: Batch Publish & Grouped Dispatch");
+K_TEST_CASE(unit_test_message_bus_lanes, "MessageBus: Priority Lanes & Dispatch Budget");
+K_TEST_CASE(unit_test_message_bus_coalescing, "MessageBus: Enqueue-Time Coalescing");
+K_TEST_CASE(unit_test_message_bus_backpressure, "MessageBus: Bounded Lanes & Backpressure");
+K_TEST_CASE(unit_test_mailbox_ring, "Mailbox: Fixed-Capacity Ring");
+K_TEST_CASE(unit_test_mailbox_block_and_wake, "Mailbox: Blocking Receive & Wakeup");
+K_TEST_CASE(unit_test_ipc_call_handoff, "IPC: Call/Reply Direct Handoff");
+K_TEST_CASE(unit_test_ipc_kernel_call, "IPC: Kernel Service Call");
+K_TEST_CASE(unit_test_buffer_grant_refcount, "BufferGrant: Refcount & Return to Pool");
+K_TEST_CASE(unit_test_buffer_grant_ipc_transfer, "BufferGrant: Transfer With Message");
+K_TEST_CASE(unit_test_typed_channel, "Channel: Typed Payloads & Out-of-Line Storage");
+K_TEST_CASE(unit_test_notification_signal_wait, "Notification: Signal Bits & Wait");
+K_TEST_CASE(unit_test_stream_ring_spsc, "StreamRing: Shared-Memory SPSC Channel");
 
 // --- 引导与任务创建 ---
 K_TEST_CASE(unit_test_task_creation_integrity, "Task Creation Integrity");
@@ -8,6 +8,7 @@ class MockSchedulingControl : public ISchedulingControl
 {
 public:
     bool yield_called = false;
+    bool block_called = false;
 
     void yield_current_task() override
     {
@@ -15,6 +16,17 @@ public:
         std::cout << "[Mock] Task requested yield." << std::endl;
     }
 
+    void block_current_task() override
+    {
+        block_called = true;
+        std::cout << "[Mock] Task requested block." << std::endl;
+    }
+
+    void invoke_ipc(SignalEvent op) override
+    {
+        std::cout << "[Mock] Task invoked IPC 0x" << std::hex << static_cast<uint32_t>(op) << std::dec << std::endl;
+    }
+
     void terminate_current_task() override
     {
         std::cout << "[Mock] Task requested termination." << std::endl;
@@ -1,7 +1,6 @@
 #pragma once
 #include <iostream>
 #include <vector>
-#include <windows.h>
 
 #include <kernel/ISchedulingControl.hpp>
 #include <kernel/ISignal.hpp>
@@ -33,7 +33,7 @@ void unit_test_bootstrap()
     // 3. Verification: 使用 Mock 封装的逻辑进行断言
     std::cout << "[Test] Verifying Kernel Bootstrap..." << std::endl;
 
-    HeapInspector hi(ki.heap());
+    HeapInspector<RuntimeHeapAllocator> hi(ki.heap());
 
     // A. 验证基础设施组件是否已挂载
     // 注意：这里使用你封装在 Mock 或 Inspector 中的 Getter
@@ -0,0 +1,97 @@
+// unit/test_buffer_grant.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/BufferGrantTable.hpp>
+#include <kernel/IpcService.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include "mock/MockTaskContext.hpp"
+
+inline void unit_test_buffer_grant_refcount()
+{
+    alignas(64) static uint8_t pool[64 * 1024];
+    static BufferGrantTable table(pool, sizeof(pool));
+    const uint32_t A = 1, B = 2, C = 3;
+
+    // 1. 创建：只有持有者能映射
+    uint32_t handle = table.create(4096, A);
+    K_T_ASSERT(handle != BufferGrantTable::INVALID_HANDLE, "Grant creation failed");
+    uint32_t size = 0;
+    auto *data = static_cast<uint8_t *>(table.map(handle, A, &size));
+    K_T_ASSERT(data && size == 4096, "Owner must be able to map the grant");
+    K_T_ASSERT(!table.map(handle, B), "Non-holder must not map the grant");
+    data[0] = 0x5A;
+
+    // 2. 共享：A 先保留一份再移交给 B，两者看到同一块内存
+    K_T_ASSERT(table.retain(handle, A) && table.transfer(handle, A, B), "Share failed");
+    K_T_ASSERT(table.ref_count(handle) == 2, "Share must leave two references");
+    K_T_ASSERT(static_cast<uint8_t *>(table.map(handle, B))[0] == 0x5A, "Zero-copy view mismatch");
+    K_T_ASSERT(!table.transfer(handle, C, A), "Non-holder must not transfer");
+
+    // 3. 最后一个引用释放后归还池，陈旧句柄失效
+    K_T_ASSERT(table.release(handle, A) && table.map(handle, B), "Remaining holder lost access");
+    K_T_ASSERT(table.release(handle, B), "Final release failed");
+    K_T_ASSERT(table.live_count() == 0 && !table.map(handle, B), "Released grant must be gone");
+
+    uint32_t reused = table.create(4096, C);
+    K_T_ASSERT(reused != handle && !table.release(handle, C), "Stale handle must not alias a recycled record");
+
+    // 4. 池耗尽
+    K_T_ASSERT(table.create(1024 * 1024, C) == BufferGrantTable::INVALID_HANDLE, "Oversized grant must fail");
+
+    // 5. 任务回收时一次释放全部引用
+    table.retain(reused, C);
+    K_T_ASSERT(table.release_all(C) == 2 && table.live_count() == 0, "release_all must drop every reference");
+}
+
+/**
+ * 随点对点消息移交：投递成功才转移引用
+ */
+inline void unit_test_buffer_grant_ipc_transfer()
+{
+    alignas(64) static uint8_t arena[32 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+
+    alignas(64) static uint8_t pool[16 * 1024];
+    static BufferGrantTable grants(pool, sizeof(pool));
+
+    MockTaskContext ctx_a, ctx_b;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock producer(1, &ctx_a, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock consumer(2, &ctx_b, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    lifecycle.register_task(&producer);
+    lifecycle.register_task(&consumer);
+
+    PriorityStrategy strategy;
+    TaskScheduler scheduler(&strategy, nullptr);
+    IpcService ipc(&lifecycle, &scheduler, &grants);
+    scheduler.set_current(&producer);
+
+    Message msg{};
+    msg.grant = grants.create(2048, producer.get_id());
+
+    // 1. 移交：生产者失去访问权，消费者获得
+    K_T_ASSERT(ipc.send(consumer.get_id(), msg), "Send with grant failed");
+    K_T_ASSERT(!grants.map(msg.grant, producer.get_id()) && grants.map(msg.grant, consumer.get_id()), "Grant must move with the message");
+
+    // 2. 不再持有时不能再次发送，信箱不变
+    size_t queued = consumer.mailbox.count();
+    K_T_ASSERT(!ipc.send(consumer.get_id(), msg) && consumer.mailbox.count() == queued, "Sending an unheld grant must fail cleanly");
+
+    // 3. 信箱已满时引用留在发送方
+    Message plain{};
+    while (consumer.mailbox.count() < Mailbox::INLINE_CAPACITY)
+        ipc.send(consumer.get_id(), plain);
+    Message full{};
+    full.grant = grants.create(512, producer.get_id());
+    K_T_ASSERT(!ipc.send(consumer.get_id(), full) && grants.map(full.grant, producer.get_id()), "Failed send must keep the grant with the sender");
+}
@@ -0,0 +1,118 @@
+// unit/test_channel.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <common/Channel.hpp>
+#include <kernel/MessageBus.hpp>
+#include <kernel/KernelProxy.hpp>
+#include <kernel/IpcService.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include "mock/MockTaskContext.hpp"
+
+struct ChannelTestPoint
+{
+    int32_t x;
+    int32_t y;
+    uint16_t tag;
+};
+
+struct ChannelTestBlob
+{
+    uint32_t length;
+    uint8_t bytes[124];
+};
+
+using PointChannel = Channel<MessageType::KERNEL_EVENT, ChannelTestPoint>;
+using BlobChannel = Channel<MessageType::SYS_LOAD_TASK, ChannelTestBlob>;
+
+static_assert(PointChannel::INLINE, "Small payload must be carried inline");
+static_assert(!BlobChannel::INLINE, "Oversized payload must go out of line");
+static_assert(!TaskSpawnChannel::INLINE, "Spawn parameters exceed the inline payload");
+
+struct ChannelTestSink
+{
+    ChannelTestPoint last_point{};
+    int points = 0;
+    uint32_t blob_sum = 0;
+    int blobs = 0;
+
+    void on_point(const ChannelTestPoint &p)
+    {
+        last_point = p;
+        points++;
+    }
+
+    void on_blob(const ChannelTestBlob &blob)
+    {
+        for (uint32_t i = 0; i < blob.length; ++i)
+            blob_sum += blob.bytes[i];
+        blobs++;
+    }
+};
+
+inline void unit_test_typed_channel()
+{
+    alignas(64) static uint8_t arena[128 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+    auto *bus = builder.construct<MessageBus>(&builder);
+
+    alignas(64) static uint8_t pool[16 * 1024];
+    static BufferGrantTable grants(pool, sizeof(pool));
+    bus->set_grant_table(&grants);
+
+    MockTaskContext ctx;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock task(1, &ctx, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    lifecycle.register_task(&task);
+    PriorityStrategy strategy;
+    TaskScheduler scheduler(&strategy, nullptr);
+    IpcService ipc(&lifecycle, &scheduler, &grants);
+    scheduler.set_current(&task);
+
+    PlatformHooks hooks{};
+    KernelRuntimeProxy proxy(bus, &hooks, &scheduler, &ipc);
+
+    ChannelTestSink sink;
+    bus->subscribe_channel<PointChannel, ChannelTestSink, &ChannelTestSink::on_point>(&sink);
+    bus->subscribe_channel<BlobChannel, ChannelTestSink, &ChannelTestSink::on_blob>(&sink);
+
+    // 1. 内联载荷：按类型往返，处理函数经专属跳板直接调用
+    Message msg = PointChannel::make({-3, 7, 0xBEEF});
+    K_T_ASSERT(msg.type == MessageType::KERNEL_EVENT && PointChannel::read(msg).tag == 0xBEEF, "Inline round trip failed");
+    K_T_ASSERT(PointChannel::publish(&proxy, {5, -6, 1}) == PublishResult::Ok, "Inline publish failed");
+    bus->dispatch_messages();
+    K_T_ASSERT(sink.points == 1 && sink.last_point.x == 5 && sink.last_point.y == -6, "Typed handler got the wrong payload");
+
+    // 2. 超出 payload 的载荷：自动经缓冲授权交给内核，分发后释放
+    ChannelTestBlob blob{};
+    blob.length = sizeof(blob.bytes);
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < blob.length; ++i)
+    {
+        blob.bytes[i] = static_cast<uint8_t>(i);
+        expected += blob.bytes[i];
+    }
+    K_T_ASSERT(BlobChannel::publish(&proxy, blob) == PublishResult::Ok && grants.live_count() == 1, "Out-of-line publish failed");
+    bus->dispatch_messages();
+    K_T_ASSERT(sink.blobs == 1 && sink.blob_sum == expected, "Out-of-line payload corrupted");
+    K_T_ASSERT(grants.live_count() == 0, "Dispatched payload must release its grant");
+
+    // 3. 未能入队时授权退回并释放，不泄漏
+    bus->set_lane_capacity(MessageLane::Normal, 1);
+    bus->publish(PointChannel::make({0, 0, 0}));
+    K_T_ASSERT(BlobChannel::publish(&proxy, blob) == PublishResult::Full && grants.live_count() == 0, "Rejected payload leaked its grant");
+
+    // 4. 退订后不再投递到处理函数
+    bus->unsubscribe_channel<PointChannel, ChannelTestSink, &ChannelTestSink::on_point>(&sink);
+    bus->dispatch_messages();
+    K_T_ASSERT(sink.points == 1, "Unsubscribed handler still invoked");
+
+    builder.destroy(bus);
+}
@@ -0,0 +1,114 @@
+// unit/test_futex.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <common/Futex.hpp>
+#include <kernel/FutexTable.hpp>
+#include <kernel/IpcService.hpp>
+#include <kernel/KernelProxy.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/SignalDispatcher.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include "mock/MockTaskContext.hpp"
+
+/**
+ * 把代理的陷入直接送进分发器（相当于同步触发的陷入门）
+ */
+struct FutexTestTrap : ISchedulingControl
+{
+    SignalDispatcher *dispatcher = nullptr;
+    uint32_t traps = 0;
+
+    void yield_current_task() override {}
+    void terminate_current_task() override {}
+    void block_current_task() override { invoke_ipc(SignalEvent::Block); }
+    void invoke_ipc(SignalEvent op) override
+    {
+        traps++;
+        SignalPacket packet{};
+        packet.type = SignalType::Yield;
+        packet.event_id = op;
+        dispatcher->dispatch(packet);
+    }
+};
+
+/**
+ * futex：值不符时不睡眠；按地址唤醒指定数量；限时等待到期返回；无竞争的锁不进入内核
+ */
+inline void unit_test_futex_wait_wake()
+{
+    alignas(64) static uint8_t arena[32 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+
+    MockTaskContext ctx_a, ctx_b, ctx_c, ctx_main;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock a(1, &ctx_a, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock b(2, &ctx_b, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock c(3, &ctx_c, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock main_task(4, &ctx_main, exec, TaskResourceConfig(TaskPriority::LOW, nullptr));
+
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    PriorityStrategy strategy;
+    PrioritySchedulingPolicy policy;
+    TaskScheduler scheduler(&strategy, &policy);
+    static FutexTable futexes;
+    IpcService ipc(&lifecycle, &scheduler, nullptr, nullptr, &futexes);
+    SignalDispatcher dispatcher(scheduler, 10, &ipc);
+
+    FutexTestTrap trap;
+    trap.dispatcher = &dispatcher;
+    PlatformHooks hooks{};
+    hooks.sched_control = &trap;
+    KernelRuntimeProxy proxy(nullptr, &hooks, &scheduler, &ipc);
+
+    volatile uint32_t word_a = 7, word_b = 9;
+    auto wait_on = [&](ITaskControlBlock *task, volatile uint32_t *addr, uint32_t expected)
+    {
+        scheduler.set_current(task);
+        strategy.make_task_ready(&main_task);
+        return futexes.wait(scheduler, addr, expected);
+    };
+
+    // 1. 值已改变：不睡眠，经代理返回 ValueChanged
+    scheduler.set_current(&main_task);
+    K_T_ASSERT(proxy.futex_wait(&word_a, 8, 0) == FutexWaitResult::ValueChanged && trap.traps == 1, "Mismatched value must not sleep");
+    K_T_ASSERT(scheduler.get_current() == &main_task, "Mismatched wait must keep running");
+
+    // 2. 按地址唤醒：只唤醒等在该地址上的任务，且不超过 count
+    K_T_ASSERT(wait_on(&a, &word_a, 7) && wait_on(&b, &word_a, 7) && wait_on(&c, &word_b, 9), "Waiters must block");
+    K_T_ASSERT(a.get_state() == TaskState::BLOCKED && c.get_state() == TaskState::BLOCKED, "Waiters must be BLOCKED");
+
+    scheduler.set_current(&main_task);
+    K_T_ASSERT(proxy.futex_wake(&word_a, 1) == 1 && a.get_state() == TaskState::READY && b.get_state() == TaskState::BLOCKED, "Wake must honour the count and FIFO order");
+    K_T_ASSERT(proxy.futex_wake(&word_b, 5) == 1 && c.get_state() == TaskState::READY, "Wake must find waiters of the given address only");
+    K_T_ASSERT(proxy.futex_wake(&word_a, UINT32_MAX) == 1 && b.get_state() == TaskState::READY, "Wake-all must drain the address");
+    K_T_ASSERT(proxy.futex_wake(&word_a, 1) == 0, "No waiters left");
+
+    // 3. 限时等待：截止时间到达后离开等待队列
+    strategy.remove_task(&a);
+    scheduler.set_current(&a);
+    strategy.make_task_ready(&main_task);
+    K_T_ASSERT(futexes.wait(scheduler, &word_a, 7, scheduler.now_ms() + 5), "Timed wait must block");
+    scheduler.on_tick(10);
+    K_T_ASSERT(a.get_state() == TaskState::READY && a.wait_timed_out && proxy.futex_wake(&word_a, 1) == 0, "Timed-out waiter must leave the table");
+
+    // 4. 无竞争的锁与条件通知完全在用户态完成
+    static FutexMutex mutex;
+    static FutexCondition cond;
+    uint32_t traps = trap.traps;
+    uint64_t waits = futexes.wait_count();
+    for (int i = 0; i < 3; ++i)
+    {
+        mutex.lock(&proxy);
+        K_T_ASSERT(mutex.is_locked() && !mutex.try_lock(), "Mutex must be held");
+        cond.notify_all(&proxy);
+        mutex.unlock(&proxy);
+    }
+    K_T_ASSERT(!mutex.is_locked() && trap.traps == traps && futexes.wait_count() == waits, "Uncontended locking must not enter the kernel");
+}
@@ -0,0 +1,81 @@
+// unit/test_intrusive_list.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/IntrusiveList.hpp>
+#include <kernel/RoundRobinStrategy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+
+struct IntrusiveProbe
+{
+    int value;
+    IntrusiveListNode link;
+};
+
+typedef IntrusiveList<IntrusiveProbe, &IntrusiveProbe::link> ProbeList;
+
+inline void unit_test_intrusive_list_basic()
+{
+    IntrusiveProbe items[4] = {{0, {}}, {1, {}}, {2, {}}, {3, {}}};
+    ProbeList list;
+
+    K_T_ASSERT(list.empty() && list.front() == nullptr, "New list should be empty");
+
+    // 1. 入队顺序与 container_of 还原
+    for (auto &item : items)
+        K_T_ASSERT(list.push_back(&item), "push_back failed");
+    K_T_ASSERT(list.size() == 4, "Size mismatch after push");
+    K_T_ASSERT(list.front() == &items[0], "container_of returned wrong owner");
+
+    // 2. 已挂链的元素不能再次入队（取代旧的 is_queued 标记）
+    K_T_ASSERT(!list.push_back(&items[1]), "Double enqueue must be rejected");
+
+    ProbeList other;
+    K_T_ASSERT(!other.push_back(&items[2]), "Element linked elsewhere must be rejected");
+    K_T_ASSERT(!other.remove(&items[2]), "Removing from a foreign list must fail");
+
+    // 3. 中间摘除为 O(1)，且保持其余顺序
+    K_T_ASSERT(list.remove(&items[2]), "remove failed");
+    K_T_ASSERT(!items[2].link.is_linked(), "Removed hook still marked linked");
+    K_T_ASSERT(list.size() == 3, "Size mismatch after remove");
+
+    int expected[] = {0, 1, 3};
+    int idx = 0;
+    list.for_each([&](IntrusiveProbe *p)
+                  { K_T_ASSERT(p->value == expected[idx++], "Order broken at " << idx); });
+
+    // 4. 出队后可以重新入队
+    IntrusiveProbe *head = list.pop_front();
+    K_T_ASSERT(head == &items[0], "pop_front returned wrong element");
+    K_T_ASSERT(list.push_back(head), "Re-enqueue after pop failed");
+    K_T_ASSERT(list.front() == &items[1], "Front should advance after pop");
+
+    list.clear();
+    K_T_ASSERT(list.empty() && list.size() == 0, "clear failed");
+    for (auto &item : items)
+        K_T_ASSERT(!item.link.is_linked(), "clear left hooks linked");
+}
+
+inline void unit_test_round_robin_intrusive_queue()
+{
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    TaskResourceConfig res{TaskPriority::NORMAL, nullptr};
+    SimpleTaskControlBlock a(1, nullptr, exec, res);
+    SimpleTaskControlBlock b(2, nullptr, exec, res);
+    SimpleTaskControlBlock c(3, nullptr, exec, res);
+
+    RoundRobinStrategy strategy;
+
+    strategy.make_task_ready(&a);
+    strategy.make_task_ready(&b);
+    strategy.make_task_ready(&a); // 重复就绪应被忽略
+    strategy.make_task_ready(&c);
+
+    strategy.remove_task(&b);
+    K_T_ASSERT(!b.sched_link.is_linked(), "remove_task did not unlink TCB");
+
+    K_T_ASSERT(strategy.pick_next_ready_task() == &a, "Expected A first");
+    K_T_ASSERT(strategy.pick_next_ready_task() == &c, "Expected C second");
+    K_T_ASSERT(strategy.pick_next_ready_task() == nullptr, "Queue should be drained");
+}
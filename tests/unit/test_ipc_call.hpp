@@ -0,0 +1,144 @@
+// unit/test_ipc_call.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/IpcService.hpp>
+#include <kernel/KernelProxy.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/SignalDispatcher.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include "mock/MockTaskContext.hpp"
+
+/**
+ * call / reply_and_wait 的陷入路径：参数按代理的约定暂存在 TCB 后直接分发陷入信号
+ * MockTaskContext 的切换为空操作，只校验调度器的逻辑状态
+ */
+inline void unit_test_ipc_call_handoff()
+{
+    alignas(64) static uint8_t arena[32 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+
+    MockTaskContext ctx_server, ctx_client, ctx_idle, ctx_urgent;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock server(1, &ctx_server, exec, TaskResourceConfig(TaskPriority::LOW, nullptr));
+    SimpleTaskControlBlock client(2, &ctx_client, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock idle(3, &ctx_idle, exec, TaskResourceConfig(TaskPriority::IDLE, nullptr));
+    SimpleTaskControlBlock urgent(4, &ctx_urgent, exec, TaskResourceConfig(TaskPriority::HIGH, nullptr));
+
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    lifecycle.register_task(&server);
+    lifecycle.register_task(&client);
+    lifecycle.register_task(&idle);
+    lifecycle.register_task(&urgent);
+
+    PriorityStrategy strategy;
+    PrioritySchedulingPolicy policy;
+    TaskScheduler scheduler(&strategy, &policy);
+    IpcService ipc(&lifecycle, &scheduler);
+    SignalDispatcher dispatcher(scheduler, 10, &ipc);
+
+    auto trap = [&](SignalEvent op)
+    {
+        SignalPacket packet{};
+        packet.type = SignalType::Yield;
+        packet.event_id = op;
+        dispatcher.dispatch(packet);
+    };
+
+    strategy.make_task_ready(&client);
+    strategy.make_task_ready(&idle);
+    scheduler.set_current(&server);
+
+    // 1. 服务端等待请求
+    trap(SignalEvent::Block);
+    K_T_ASSERT(scheduler.get_current() == &client && server.ipc.wait == IpcWait::Receive, "Server must block in receive");
+
+    // 2. call：直接移交给低优先级的服务端，不经过就绪队列，时间片随之转移
+    Message request{}, reply{};
+    request.type = MessageType::EVENT_PRINT;
+    request.payload[0] = 7;
+    client.ipc.partner = server.get_id();
+    client.ipc.outgoing = &request;
+    client.ipc.reply_buf = &reply;
+
+    const uint32_t donated = client.slice.remaining_ms;
+    trap(SignalEvent::Call);
+    K_T_ASSERT(client.ipc.ok, "Call to a waiting server must succeed");
+    K_T_ASSERT(scheduler.get_current() == &server, "Call must hand the CPU straight to the server");
+    K_T_ASSERT(!server.sched_link.is_linked() && !client.sched_link.is_linked(), "Handoff must not touch the ready queue");
+    K_T_ASSERT(client.get_state() == TaskState::BLOCKED && client.ipc.wait == IpcWait::Reply, "Caller must wait for the reply");
+    K_T_ASSERT(server.slice.remaining_ms == donated, "Server must run on the caller's remaining slice");
+
+    Message got{};
+    K_T_ASSERT(ipc.try_receive(got) && got.payload[0] == 7 && got.sender == client.get_id(), "Request must arrive stamped with the caller");
+
+    // 3. reply_and_wait：回复写入调用方缓冲，CPU 直接交还调用方，服务端重新等待
+    Message response{};
+    response.payload[0] = 8;
+    server.ipc.partner = got.sender;
+    server.ipc.outgoing = &response;
+    trap(SignalEvent::Reply);
+    K_T_ASSERT(server.ipc.ok && reply.payload[0] == 8 && reply.sender == server.get_id(), "Reply must land in the caller's buffer");
+    K_T_ASSERT(scheduler.get_current() == &client && client.ipc.wait == IpcWait::None, "Reply must hand the CPU back to the caller");
+    K_T_ASSERT(server.get_state() == TaskState::BLOCKED && server.ipc.wait == IpcWait::Receive, "Server must wait for the next request");
+    K_T_ASSERT(scheduler.handoff_count() == 2, "Round trip must be two direct handoffs");
+
+    // 4. 有更高优先级的就绪任务时不越过它：退回常规唤醒路径
+    strategy.make_task_ready(&urgent);
+    trap(SignalEvent::Call);
+    K_T_ASSERT(client.ipc.ok && scheduler.get_current() == &urgent, "Handoff must not bypass a higher priority task");
+    K_T_ASSERT(server.get_state() == TaskState::READY && server.sched_link.is_linked(), "Server must be woken through the ready queue");
+    K_T_ASSERT(scheduler.handoff_count() == 2, "Fallback path must not count as a handoff");
+
+    // 5. 回复一个并未等待的客户端
+    scheduler.set_current(&server);
+    K_T_ASSERT(ipc.try_receive(got), "Queued request lost");
+    server.ipc.partner = idle.get_id();
+    trap(SignalEvent::Reply);
+    K_T_ASSERT(!server.ipc.ok, "Reply to a task not waiting must fail");
+
+    // 6. 回复无法送达（授权不可移交）：等待中的客户端带着失败返回，不会永远阻塞
+    K_T_ASSERT(client.get_state() == TaskState::BLOCKED && client.ipc.wait == IpcWait::Reply, "Caller must still wait for the reply");
+    scheduler.set_current(&server);
+    Message undeliverable{};
+    undeliverable.payload[0] = 9;
+    undeliverable.grant = 5;
+    server.ipc.partner = client.get_id();
+    server.ipc.outgoing = &undeliverable;
+    trap(SignalEvent::Reply);
+    K_T_ASSERT(!server.ipc.ok && !client.ipc.ok, "Undeliverable reply must fail on both sides");
+    K_T_ASSERT(client.ipc.wait == IpcWait::None && client.get_state() != TaskState::BLOCKED, "Caller must be released");
+    K_T_ASSERT(reply.payload[0] == 8, "Undeliverable reply must not touch the caller's buffer");
+}
+
+/**
+ * 内核服务端点：代理就地应答，不陷入
+ */
+inline void unit_test_ipc_kernel_call()
+{
+    ResourceManager resources;
+    static uint32_t fake_regs[4];
+    resources.register_hw("DISPLAY_REGS", (uintptr_t)fake_regs, sizeof(fake_regs));
+
+    PlatformHooks hooks{};
+    hooks.resource_manager = &resources;
+    KernelRuntimeProxy proxy(nullptr, &hooks);
+
+    Message request{}, reply{};
+    request.type = MessageType::REQUEST_HARDWARE_INFO;
+    request.payload[0] = (uintptr_t) "DISPLAY_REGS";
+    K_T_ASSERT(proxy.call(KERNEL_TASK_ID, request, reply), "Kernel call must succeed");
+    K_T_ASSERT(reply.payload[0] == (uintptr_t)fake_regs && reply.payload[1] == sizeof(fake_regs), "Hardware info reply wrong");
+
+    request.payload[0] = (uintptr_t) "NO_SUCH_DEVICE";
+    K_T_ASSERT(!proxy.call(KERNEL_TASK_ID, request, reply), "Unknown resource must fail");
+
+    // 没有 IpcService 时任务间调用直接失败
+    K_T_ASSERT(!proxy.call(5, request, reply), "Task call without IPC must fail");
+}
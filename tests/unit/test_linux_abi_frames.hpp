@@ -0,0 +1,57 @@
+#pragma once
+
+#include "test_framework.hpp"
+#include <simulator/LinuxTaskContext.hpp>
+#include <simulator/LinuxX64Regs.hpp>
+#include <cstdlib>
+
+extern "C" void context_start_trampoline();
+extern "C" void context_exit_trampoline();
+
+// --- 验证上下文初始栈布局是否符合 System V ABI ---
+void unit_test_sysv_context_abi()
+{
+    LinuxTaskContext ctx;
+
+    const size_t STACK_SIZE = 4096;
+    void *stack_mem = std::aligned_alloc(16, STACK_SIZE);
+    void *stack_top = static_cast<uint8_t *>(stack_mem) + STACK_SIZE;
+
+    // 预设测试值
+    uintptr_t mock_entry = 0xDEADC0DE;
+    uintptr_t mock_proxy = 0x11112222;
+    uintptr_t mock_config = 0x33334444;
+
+    ctx.load_argument(0, mock_proxy);
+    ctx.load_argument(1, mock_config);
+    ctx.setup_flow((void (*)(void *, void *))mock_entry, stack_top);
+
+    // --- 校验 1: 参数寄存器镜像 (RDI, RSI) ---
+    auto *regs = static_cast<LinuxX64Regs *>(ctx.get_stack_pointer());
+    bool args_ok = regs->rdi == mock_proxy && regs->rsi == mock_config;
+
+    // --- 校验 2: context_switch_asm 的 ret 目标必须是启动跳板，入口点经 R12 转交 ---
+    uintptr_t sp_at_rip = (uintptr_t)ctx.get_stack_pointer() + sizeof(LinuxX64Regs);
+    bool rip_ok = *reinterpret_cast<uintptr_t *>(sp_at_rip) == reinterpret_cast<uintptr_t>(context_start_trampoline) &&
+                  regs->r12 == mock_entry;
+
+    // --- 校验 3: 16字节对齐契约 (进入函数瞬间 RSP = 16n + 8) ---
+    uintptr_t sp_at_entry = sp_at_rip + 8;
+    bool align_ok = sp_at_entry % 16 == 8;
+
+    // --- 校验 4: 入口函数的返回地址必须落入退出跳板 ---
+    bool exit_ok = *reinterpret_cast<uintptr_t *>(sp_at_entry) == reinterpret_cast<uintptr_t>(context_exit_trampoline);
+
+    // --- 校验 5: 栈边界 ---
+    bool bounds_ok = (uintptr_t)ctx.get_stack_pointer() >= (uintptr_t)stack_mem;
+
+    std::free(stack_mem);
+
+    K_T_ASSERT(args_ok, "ABI Error: RDI/RSI parameter mapping failed.");
+    K_T_ASSERT(rip_ok, "ABI Error: First return target must be the start trampoline carrying the entry in R12.");
+    K_T_ASSERT(align_ok, "ABI Violation: RSP alignment at entry must be 16n + 8");
+    K_T_ASSERT(exit_ok, "ABI Error: Entry return address must be the exit trampoline.");
+    K_T_ASSERT(bounds_ok, "Stack Overflow");
+
+    std::cout << "  [PASS] System V x64 ABI Contract Verified." << std::endl;
+}
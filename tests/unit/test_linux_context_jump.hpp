@@ -0,0 +1,64 @@
+#pragma once
+
+#include "test_framework.hpp"
+#include <simulator/LinuxTaskContext.hpp>
+#include <cstdlib>
+#include <iostream>
+
+// 用于跨上下文恢复测试现场
+static bool g_sysv_logic_executed = false;
+static bool g_sysv_entry_aligned = false;
+static bool g_sysv_exit_aligned = false;
+static uintptr_t g_sysv_args[2] = {0, 0};
+static LinuxTaskContext *g_sysv_main_context = nullptr;
+
+// 1. 退出桩：任务入口返回后经由跳板进入这里，切回主上下文
+__attribute__((noinline)) void sysv_exit_stub()
+{
+    // 带帧指针时，进入函数后 push rbp，RBP 必须是 16n
+    g_sysv_exit_aligned = reinterpret_cast<uintptr_t>(__builtin_frame_address(0)) % 16 == 0;
+
+    // 已结束任务的现场无处可去，保存到一个临时上下文中
+    LinuxTaskContext garbage;
+    garbage.transit_to(g_sysv_main_context);
+}
+
+// 2. 任务入口
+__attribute__((noinline)) void sysv_task_entry(void *rt, void *config)
+{
+    g_sysv_logic_executed = true;
+    g_sysv_args[0] = reinterpret_cast<uintptr_t>(rt);
+    g_sysv_args[1] = reinterpret_cast<uintptr_t>(config);
+
+    // 关键校验：进入函数时 RSP 必须是 16n + 8，push rbp 后 RBP 为 16n
+    g_sysv_entry_aligned = reinterpret_cast<uintptr_t>(__builtin_frame_address(0)) % 16 == 0;
+
+    std::cout << "[INFO] Task Logic Running. Testing stack with complex call..." << std::endl;
+}
+
+// 3. 自动化测试用例：真实切入任务，再经由退出桩回到主线程
+void unit_test_sysv_context_switch_lifecycle()
+{
+    LinuxTaskContext main_ctx;
+    LinuxTaskContext task_ctx(reinterpret_cast<void *>(sysv_exit_stub));
+    g_sysv_main_context = &main_ctx;
+
+    const size_t STACK_SIZE = 8192;
+    void *stack_mem = std::aligned_alloc(16, STACK_SIZE);
+    void *stack_top = static_cast<uint8_t *>(stack_mem) + STACK_SIZE - 128;
+
+    task_ctx.load_argument(0, 0x123);
+    task_ctx.load_argument(1, 0x456);
+    task_ctx.setup_flow(sysv_task_entry, stack_top);
+
+    // --- 执行切换 ---
+    main_ctx.transit_to(&task_ctx);
+
+    // --- 当任务运行结束执行退出桩时，代码从这里恢复 ---
+    std::free(stack_mem);
+
+    K_T_ASSERT(g_sysv_logic_executed, "Task entry was never executed");
+    K_T_ASSERT(g_sysv_args[0] == 0x123 && g_sysv_args[1] == 0x456, "Arguments were not delivered in RDI/RSI");
+    K_T_ASSERT(g_sysv_entry_aligned, "ABI Alignment Violation at task entry");
+    K_T_ASSERT(g_sysv_exit_aligned, "ABI Alignment Violation at exit stub");
+}
@@ -0,0 +1,128 @@
+// unit/test_mailbox.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/Mailbox.hpp>
+#include <kernel/IpcService.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/SignalDispatcher.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include "mock/MockTaskContext.hpp"
+
+inline void unit_test_mailbox_ring()
+{
+    Mailbox box;
+    Message msg{};
+
+    // 1. 容量内 FIFO，满后拒绝并计数
+    for (uint64_t i = 0; i < Mailbox::INLINE_CAPACITY; ++i)
+    {
+        msg.payload[0] = i;
+        K_T_ASSERT(box.push(msg), "Mailbox rejected a push below capacity");
+    }
+    K_T_ASSERT(box.full() && !box.push(msg), "Full mailbox must reject the push");
+    K_T_ASSERT(box.rejected_count() == 1, "Rejected push must be counted");
+
+    // 2. 取出一条后可以跨圈复用槽位
+    Message out{};
+    K_T_ASSERT(box.pop(out) && out.payload[0] == 0, "FIFO order broken");
+    msg.payload[0] = Mailbox::INLINE_CAPACITY;
+    K_T_ASSERT(box.push(msg), "Released slot must be reusable");
+
+    for (uint64_t i = 1; i <= Mailbox::INLINE_CAPACITY; ++i)
+        K_T_ASSERT(box.pop(out) && out.payload[0] == i, "Wrapped FIFO order broken");
+    K_T_ASSERT(box.empty() && !box.pop(out), "Drained mailbox must be empty");
+    K_T_ASSERT(box.high_water() == Mailbox::INLINE_CAPACITY, "High-water mark must record the peak backlog");
+
+    // 3. 收紧容量上限：只接受 limit 条积压
+    K_T_ASSERT(!box.set_limit(0) && !box.set_limit(Mailbox::INLINE_CAPACITY + 1) && box.set_limit(2), "Limit validation wrong");
+    K_T_ASSERT(box.push(msg) && box.push(msg) && !box.push(msg), "Mailbox must honour its configured limit");
+
+    // 4. 外部存储：只能在空信箱上接入，容量与上限随之扩大
+    Message storage[16];
+    K_T_ASSERT(!box.attach_storage(storage, 16), "Storage must not be swapped under queued messages");
+    box.clear();
+    K_T_ASSERT(!box.attach_storage(storage, 12) && box.attach_storage(storage, 16), "Storage validation wrong");
+    bool accepted = true;
+    for (uint64_t i = 0; i < 16; ++i)
+    {
+        msg.payload[0] = i;
+        accepted = accepted && box.push(msg);
+    }
+    K_T_ASSERT(accepted && box.full() && box.limit() == 16 && box.set_limit(8), "External storage must raise the capacity");
+    K_T_ASSERT(box.pop(out) && out.payload[0] == 0 && box.external_storage() == storage, "External storage FIFO broken");
+}
+
+/**
+ * 阻塞接收 / 投递唤醒：MockTaskContext 的切换为空操作，只校验调度器的逻辑状态
+ */
+inline void unit_test_mailbox_block_and_wake()
+{
+    alignas(64) static uint8_t arena[32 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+
+    MockTaskContext ctx_server, ctx_client, ctx_idle;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock server(1, &ctx_server, exec, TaskResourceConfig(TaskPriority::HIGH, nullptr));
+    SimpleTaskControlBlock client(2, &ctx_client, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock idle(3, &ctx_idle, exec, TaskResourceConfig(TaskPriority::IDLE, nullptr));
+
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    lifecycle.register_task(&server);
+    lifecycle.register_task(&client);
+    lifecycle.register_task(&idle);
+
+    PriorityStrategy strategy;
+    PrioritySchedulingPolicy policy;
+    TaskScheduler scheduler(&strategy, &policy);
+    IpcService ipc(&lifecycle, &scheduler);
+    SignalDispatcher dispatcher(scheduler, 10, &ipc);
+
+    strategy.make_task_ready(&client);
+    strategy.make_task_ready(&idle);
+    scheduler.set_current(&server);
+
+    SignalPacket block{};
+    block.type = SignalType::Yield;
+    block.event_id = SignalEvent::Block;
+
+    // 1. 信箱为空：陷入后阻塞，让出给下一个就绪任务，且不归队
+    dispatcher.dispatch(block);
+    K_T_ASSERT(server.get_state() == TaskState::BLOCKED, "Receiver must block on an empty mailbox");
+    K_T_ASSERT(scheduler.get_current() == &client, "Blocking must switch to the next ready task");
+    K_T_ASSERT(!server.sched_link.is_linked(), "Blocked task must not sit in the ready queue");
+
+    // 2. 投递唤醒：更高优先级的接收者只登记重调度请求，由发送方离开临界区兑现
+    Message msg{};
+    msg.type = MessageType::EVENT_PRINT;
+    msg.payload[0] = 42;
+    {
+        PreemptGuard guard(&scheduler, nullptr);
+        K_T_ASSERT(ipc.send(server.get_id(), msg), "Send to a live task must succeed");
+        K_T_ASSERT(server.get_state() == TaskState::READY && server.sched_link.is_linked(), "Send must wake the receiver");
+        K_T_ASSERT(scheduler.get_current() == &client, "Wakeup must not switch inside a critical section");
+    }
+    scheduler.yield_current(); // 真实环境中由 PreemptGuard 经陷入门触发
+    K_T_ASSERT(scheduler.get_current() == &server, "Woken higher priority receiver must run next");
+
+    // 3. 消息在陷入前已送达：复查后不阻塞
+    msg.payload[0] = 43;
+    K_T_ASSERT(ipc.send(server.get_id(), msg), "Send to a running task must succeed");
+    dispatcher.dispatch(block);
+    K_T_ASSERT(scheduler.get_current() == &server && server.get_state() != TaskState::BLOCKED, "Pending message must not block");
+
+    Message out{};
+    K_T_ASSERT(ipc.try_receive(out) && out.payload[0] == 42, "Receiver lost the first message");
+    K_T_ASSERT(ipc.try_receive(out) && out.payload[0] == 43, "Receiver lost the second message");
+    K_T_ASSERT(!ipc.try_receive(out), "Mailbox must be drained");
+
+    // 4. 不存在的目标
+    K_T_ASSERT(!ipc.send(99, msg) && ipc.rejected_count() == 1, "Send to unknown task must fail");
+    K_T_ASSERT(ipc.sent_count() == 2, "Sent counter wrong");
+}
@@ -4,6 +4,16 @@
 #include "kernel/MessageBus.hpp" // 确保可以访问到 Bus 和相关的类型定义
 #include <kernel/StaticLayoutAllocator.hpp>
 #include <kernel/KernelObjectBuilder.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <vector>
+#include <common/DisplayRegs.hpp>
+#include <kernel/KernelProxy.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/SignalDispatcher.hpp>
+#include "mock/MockTaskContext.hpp"
 
 class DomainServiceMock
 {
@@ -21,8 +31,8 @@ public:
 inline void unit_test_message_system_integrity()
 {
     // 1. 环境准备
-    uint8_t scratch[2048];
-    StaticLayoutAllocator loader(scratch, 2048);
+    alignas(64) static uint8_t scratch[64 * 1024];
+    StaticLayoutAllocator loader(scratch, sizeof(scratch));
     KernelObjectBuilder builder(&loader);
 
     // 2. 构造领域模型
@@ -50,4 +60,490 @@ inline void unit_test_message_system_integrity()
     // 5. 领域规则断言
     K_T_ASSERT(service.call_count == 1, "MessageBus failed to deliver event through BIND macro");
     K_T_ASSERT(service.last_type == MessageType::EVENT_PRINT, "Message content corruption during dispatch");
-}
\ No newline at end of file
+}
+inline void unit_test_message_bus_wakeup()
+{
+    alignas(64) static uint8_t scratch[64 * 1024];
+    StaticLayoutAllocator loader(scratch, sizeof(scratch));
+    KernelObjectBuilder builder(&loader);
+
+    auto *bus = builder.construct<MessageBus>(&builder);
+
+    // 空闲循环入睡前依赖的两个契约：投递即通知、has_pending 反映未分发消息
+    int wakeups = 0;
+    bus->set_wakeup_handler([](void *ctx)
+                            { ++*static_cast<int *>(ctx); },
+                            &wakeups);
+
+    K_T_ASSERT(!bus->has_pending(), "Fresh bus must have nothing pending");
+
+    Message msg;
+    msg.type = MessageType::EVENT_PRINT;
+    bus->publish(msg);
+    bus->publish(msg);
+
+    K_T_ASSERT(wakeups == 2, "Every publish must notify the wakeup handler");
+    K_T_ASSERT(bus->has_pending(), "Published messages must be pending until dispatched");
+
+    bus->dispatch_messages();
+    K_T_ASSERT(!bus->has_pending(), "Dispatch must drain the pending queue");
+}
+
+static void dispatch_table_record(const Message &msg, void *ctx)
+{
+    // 记录回调序号，用于校验派发顺序
+    int *log = static_cast<int *>(ctx);
+    log[log[0] + 1] = static_cast<int>(msg.payload[0]);
+    log[0]++;
+}
+
+static void dispatch_table_count(const Message &, void *ctx)
+{
+    ++*static_cast<int *>(ctx);
+}
+
+// 派发期间改动订阅表：退订自身，再订阅足够多的回调迫使数组扩容
+struct DispatchMutationProbe
+{
+    MessageBus *bus;
+    int self_calls = 0;
+    int added_hits = 0;
+};
+
+static void dispatch_table_mutate(const Message &msg, void *ctx)
+{
+    auto *probe = static_cast<DispatchMutationProbe *>(ctx);
+    probe->self_calls++;
+    probe->bus->unsubscribe(msg.type, MessageCallback(dispatch_table_mutate, ctx));
+    for (uint32_t i = 0; i < 2 * MessageDispatchTable::INLINE_CALLBACKS; ++i)
+        probe->bus->subscribe(msg.type, MessageCallback(dispatch_table_count, &probe->added_hits));
+}
+
+inline void unit_test_message_dispatch_table()
+{
+    alignas(16) static uint8_t arena[64 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+
+    auto *bus = builder.construct<MessageBus>(&builder);
+
+    // 1. 稠密类型走直接下标，稀疏类型走开放寻址
+    const MessageType sparse = static_cast<MessageType>(0xBEEF00);
+    int dense_hits = 0, sparse_hits = 0;
+    bus->subscribe(MessageType::EVENT_PRINT, MessageCallback(dispatch_table_count, &dense_hits));
+    bus->subscribe(sparse, MessageCallback(dispatch_table_count, &sparse_hits));
+
+    // 2. 超过内联容量的订阅者整体迁移到外部数组，注册顺序保持不变
+    const int SUBSCRIBERS = 2 * MessageDispatchTable::INLINE_CALLBACKS + 1;
+    int counters[SUBSCRIBERS] = {};
+    for (int i = 0; i < SUBSCRIBERS; ++i)
+        bus->subscribe(MessageType::EVENT_KEYBOARD, MessageCallback(dispatch_table_count, &counters[i]));
+
+    int log[8] = {};
+    for (int i = 0; i < 3; ++i)
+        bus->subscribe(MessageType::KERNEL_EVENT, MessageCallback(dispatch_table_record, log));
+
+    Message msg{};
+    msg.type = MessageType::EVENT_PRINT;
+    bus->publish(msg);
+    msg.type = sparse;
+    bus->publish(msg);
+    msg.type = MessageType::EVENT_KEYBOARD;
+    bus->publish(msg);
+    msg.type = MessageType::EVENT_VRAM_UPDATED; // 无订阅者
+    bus->publish(msg);
+    bus->dispatch_messages();
+
+    K_T_ASSERT(dense_hits == 1, "Dense type dispatch failed");
+    K_T_ASSERT(sparse_hits == 1, "Sparse type dispatch failed");
+
+    bool all_hit = true;
+    for (int i = 0; i < SUBSCRIBERS; ++i)
+        all_hit = all_hit && counters[i] == 1;
+    K_T_ASSERT(all_hit, "Spilled callbacks must all be invoked once");
+
+    // 3. 退订移除所有相同回调；未注册的回调不影响其他订阅者
+    bus->unsubscribe(MessageType::KERNEL_EVENT, MessageCallback(dispatch_table_record, log));
+    bus->unsubscribe(MessageType::EVENT_PRINT, MessageCallback(dispatch_table_count, &sparse_hits));
+    msg.type = MessageType::KERNEL_EVENT;
+    bus->publish(msg);
+    msg.type = MessageType::EVENT_PRINT;
+    bus->publish(msg);
+    bus->dispatch_messages();
+
+    K_T_ASSERT(log[0] == 0, "Unsubscribed callbacks must not be invoked");
+    K_T_ASSERT(dense_hits == 2, "Unrelated unsubscribe removed a subscriber");
+
+    // 4. 回调中退订与扩容：后续订阅者不被跳过，新订阅者从下一条消息起生效
+    const MessageType mutated = MessageType::REQUEST_HARDWARE_INFO;
+    DispatchMutationProbe probe{bus};
+    int before = 0, after = 0;
+    bus->subscribe(mutated, MessageCallback(dispatch_table_count, &before));
+    bus->subscribe(mutated, MessageCallback(dispatch_table_mutate, &probe));
+    bus->subscribe(mutated, MessageCallback(dispatch_table_count, &after));
+
+    msg.type = mutated;
+    bus->publish(msg);
+    bus->dispatch_messages();
+    K_T_ASSERT(before == 1 && probe.self_calls == 1 && after == 1, "Mutation during dispatch must not skip subscribers");
+    K_T_ASSERT(probe.added_hits == 0, "Subscribers added during dispatch must wait for the next message");
+
+    bus->publish(msg);
+    bus->dispatch_messages();
+    K_T_ASSERT(before == 2 && probe.self_calls == 1 && after == 2, "Self-unsubscribe must take effect");
+    K_T_ASSERT(probe.added_hits == int(2 * MessageDispatchTable::INLINE_CALLBACKS), "Added subscribers must be live after dispatch");
+
+    builder.destroy(bus);
+}
+
+// 记录 (类型低字节 << 8 | 序号)，用于校验分发顺序
+static void batch_order_record(const Message &msg, void *ctx)
+{
+    auto *log = static_cast<std::vector<uint32_t> *>(ctx);
+    log->push_back((static_cast<uint32_t>(msg.type) & 0xFF) << 8 | static_cast<uint32_t>(msg.payload[0]));
+}
+
+inline void unit_test_message_bus_batch()
+{
+    alignas(64) static uint8_t arena[128 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+    auto *bus = builder.construct<MessageBus>(&builder);
+
+    std::vector<uint32_t> log;
+    bus->subscribe(MessageType::EVENT_KEYBOARD, MessageCallback(batch_order_record, &log));
+    bus->subscribe(MessageType::EVENT_PRINT, MessageCallback(batch_order_record, &log));
+
+    // 两种类型默认分属不同车道，这里放进同一车道以校验车道内的分发顺序
+    K_T_ASSERT(bus->set_lane(MessageType::EVENT_KEYBOARD, MessageLane::Normal) &&
+                   bus->set_lane(MessageType::EVENT_PRINT, MessageLane::Normal),
+               "Lane override failed");
+
+    // 交错的两种类型：键盘 0,1,2 与打印 0,1
+    Message burst[5] = {};
+    const MessageType types[5] = {MessageType::EVENT_KEYBOARD, MessageType::EVENT_PRINT, MessageType::EVENT_KEYBOARD,
+                                  MessageType::EVENT_PRINT, MessageType::EVENT_KEYBOARD};
+    const uint64_t seqs[5] = {0, 0, 1, 1, 2};
+    for (int i = 0; i < 5; ++i)
+    {
+        burst[i].type = types[i];
+        burst[i].payload[0] = seqs[i];
+    }
+
+    // 1. 默认模式：严格按投递顺序
+    K_T_ASSERT(bus->publish_batch(burst, 5) == 5, "Batch publish lost messages");
+    bus->dispatch_messages();
+    const std::vector<uint32_t> ordered = {0x0000, 0x0100, 0x0001, 0x0101, 0x0002};
+    K_T_ASSERT(log == ordered, "Ordered mode must preserve publish order");
+
+    // 2. 分组模式：按类型首次出现的顺序成组，组内保持顺序
+    log.clear();
+    bus->set_dispatch_mode(MessageBus::DispatchMode::GroupedByType);
+    bus->publish_batch(burst, 5);
+    bus->dispatch_messages();
+    const std::vector<uint32_t> grouped = {0x0000, 0x0001, 0x0002, 0x0100, 0x0101};
+    K_T_ASSERT(log == grouped, "Grouped mode must batch per type and keep per-type order");
+
+    // 3. 超过队列剩余空间：接收能放下的部分，其余计入丢弃
+    static Message flood[MessageBus::QUEUE_CAPACITY + 8];
+    for (auto &m : flood)
+        m.type = MessageType::EVENT_KEYBOARD;
+    size_t accepted = bus->publish_batch(flood, MessageBus::QUEUE_CAPACITY + 8);
+    K_T_ASSERT(accepted == MessageBus::QUEUE_CAPACITY && bus->dropped_count() == 8, "Overflowing batch must be truncated and counted");
+
+    log.clear();
+    bus->dispatch_messages();
+    K_T_ASSERT(log.size() == MessageBus::QUEUE_CAPACITY && !bus->has_pending(), "Accepted part of the batch must all be delivered");
+
+    builder.destroy(bus);
+}
+
+static uint64_t s_lane_test_clock_us = 0;
+
+static uint64_t lane_test_clock()
+{
+    return s_lane_test_clock_us;
+}
+
+/**
+ * 优先级车道与分发预算：积压的批量消息不会挡住键盘输入，预算用完时留下积压
+ */
+inline void unit_test_message_bus_lanes()
+{
+    alignas(64) static uint8_t arena[128 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+    auto *bus = builder.construct<MessageBus>(&builder);
+    bus->set_clock(lane_test_clock);
+    s_lane_test_clock_us = 1000;
+
+    std::vector<uint32_t> log;
+    bus->subscribe(MessageType::EVENT_KEYBOARD, MessageCallback(batch_order_record, &log));
+    bus->subscribe(MessageType::EVENT_PRINT, MessageCallback(batch_order_record, &log));
+    bus->subscribe(MessageType::KERNEL_EVENT, MessageCallback(batch_order_record, &log));
+    K_T_ASSERT(bus->lane_of(MessageType::EVENT_KEYBOARD) == MessageLane::Urgent &&
+                   bus->lane_of(MessageType::EVENT_PRINT) == MessageLane::Bulk &&
+                   bus->lane_of(MessageType::KERNEL_EVENT) == MessageLane::Normal,
+               "Default lane mapping wrong");
+
+    // 1. 批量消息先到，普通与键盘消息后到：分发按车道优先级
+    Message msg{};
+    msg.type = MessageType::EVENT_PRINT;
+    for (uint64_t i = 0; i < 40; ++i)
+    {
+        msg.payload[0] = i;
+        bus->publish(msg);
+    }
+    msg.type = MessageType::KERNEL_EVENT;
+    msg.payload[0] = 0;
+    bus->publish(msg);
+    msg.type = MessageType::EVENT_KEYBOARD;
+    bus->publish(msg);
+
+    // 2. 预算：每轮最多 16 条，剩余积压留待下一轮
+    s_lane_test_clock_us = 1250;
+    bus->set_dispatch_budget(16, 0);
+    bus->dispatch_messages();
+    const uint32_t keyboard = (static_cast<uint32_t>(MessageType::EVENT_KEYBOARD) & 0xFF) << 8;
+    const uint32_t kernel = (static_cast<uint32_t>(MessageType::KERNEL_EVENT) & 0xFF) << 8;
+    K_T_ASSERT(log.size() == 16 && log[0] == keyboard && log[1] == kernel, "Urgent and normal lanes must bypass bulk traffic");
+    K_T_ASSERT(bus->has_pending() && bus->budget_exhausted_count() == 1, "Exhausted budget must leave the backlog pending");
+
+    MessageLaneStats bulk = bus->lane_stats(MessageLane::Bulk);
+    K_T_ASSERT(bulk.published == 40 && bulk.dispatched == 14 && bulk.depth == 26, "Bulk lane counters wrong");
+    K_T_ASSERT(bulk.max_depth == 40 && bulk.max_age_us == 250, "Bulk lane depth/age sampling wrong");
+    K_T_ASSERT(bus->lane_stats(MessageLane::Urgent).dispatched == 1, "Urgent lane counters wrong");
+
+    // 3. 下一轮到达的键盘输入仍然先于剩余积压
+    log.clear();
+    msg.type = MessageType::EVENT_KEYBOARD;
+    msg.payload[0] = 1;
+    bus->publish(msg);
+    bus->set_dispatch_budget(0, 0);
+    bus->dispatch_messages();
+    K_T_ASSERT(log.size() == 27 && log[0] == (keyboard | 1) && !bus->has_pending(), "Backlog must drain once the budget allows");
+
+    // 4. 每条车道独立限容，满了只丢本车道的消息
+    msg.type = MessageType::EVENT_PRINT;
+    for (size_t i = 0; i < MessageBus::QUEUE_CAPACITY + 4; ++i)
+        bus->publish(msg);
+    msg.type = MessageType::EVENT_KEYBOARD;
+    bus->publish(msg);
+    K_T_ASSERT(bus->lane_stats(MessageLane::Bulk).dropped == 4 && bus->lane_stats(MessageLane::Urgent).dropped == 0,
+               "A full bulk lane must not drop urgent input");
+    K_T_ASSERT(bus->dropped_count() == 4, "Total drop counter must cover every lane");
+
+    bus->dispatch_messages();
+    builder.destroy(bus);
+}
+
+static void coalesce_union(Message &pending, const Message &incoming)
+{
+    pending = VramUpdatedChannel::make(VramUpdatedChannel::read(pending).unite(VramUpdatedChannel::read(incoming)));
+}
+
+static void coalesce_record(const Message &msg, void *ctx)
+{
+    static_cast<std::vector<DirtyRect> *>(ctx)->push_back(VramUpdatedChannel::read(msg));
+}
+
+/**
+ * 入队时合并：一个分发周期内同类型至多一条，载荷按脏矩形并集合并
+ */
+inline void unit_test_message_bus_coalescing()
+{
+    alignas(64) static uint8_t arena[128 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+    auto *bus = builder.construct<MessageBus>(&builder);
+
+    int wakeups = 0;
+    bus->set_wakeup_handler([](void *ctx)
+                            { ++*static_cast<int *>(ctx); },
+                            &wakeups);
+    K_T_ASSERT(bus->set_coalescing(MessageType::EVENT_VRAM_UPDATED, coalesce_union), "Coalescing setup failed");
+
+    std::vector<DirtyRect> refreshed;
+    int prints = 0;
+    bus->subscribe(MessageType::EVENT_VRAM_UPDATED, MessageCallback(coalesce_record, &refreshed));
+    bus->subscribe(MessageType::EVENT_PRINT, MessageCallback(dispatch_table_count, &prints));
+
+    auto publish_rect = [&](DirtyRect rect)
+    {
+        bus->publish(VramUpdatedChannel::make(rect));
+    };
+
+    // 1. 连续绘制：三次刷新请求合并为一次投递，脏矩形取并集；其他类型不受影响
+    Message print{};
+    print.type = MessageType::EVENT_PRINT;
+    publish_rect({10, 10, 5, 5});
+    bus->publish(print);
+    publish_rect({20, 0, 5, 5});
+    publish_rect({0, 30, 1, 1});
+    bus->publish(print);
+    K_T_ASSERT(wakeups == 3, "Merged publishes must not wake the dispatcher again");
+
+    bus->dispatch_messages();
+    K_T_ASSERT(refreshed.size() == 1 && prints == 2, "Burst must collapse into one delivery");
+    const DirtyRect &u = refreshed[0];
+    K_T_ASSERT(u.x == 0 && u.y == 0 && u.width == 25 && u.height == 31, "Dirty rectangles must be unioned");
+    K_T_ASSERT(bus->lane_stats(MessageLane::Normal).coalesced == 2, "Coalesced counter wrong");
+
+    // 2. 分发后槽清空：下一周期重新入队；整屏请求吸收局部矩形
+    refreshed.clear();
+    publish_rect({1, 1, 1, 1});
+    publish_rect(DirtyRect::full());
+    bus->dispatch_messages();
+    K_T_ASSERT(refreshed.size() == 1 && refreshed[0].is_full(), "Full-screen refresh must absorb partial rects");
+
+    // 3. 批量投递同样合并，被合并的消息计为已接受
+    refreshed.clear();
+    Message burst[4] = {};
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        burst[i] = VramUpdatedChannel::make({i * 10, 0, 10, 10});
+    }
+    K_T_ASSERT(bus->publish_batch(burst, 4) == 4, "Coalesced batch entries must count as accepted");
+    bus->dispatch_messages();
+    K_T_ASSERT(refreshed.size() == 1 && refreshed[0].width == 40 && !bus->has_pending(), "Batch must collapse into one delivery");
+
+    builder.destroy(bus);
+}
+
+/**
+ * 模拟 publish_wait 的陷入门：投递者阻塞后由“空闲任务”分发一轮并唤醒投递者，再切回投递者
+ */
+struct PublishWaitTrap : ISchedulingControl
+{
+    SignalDispatcher *dispatcher = nullptr;
+    IMessageBus *bus = nullptr;
+    IpcService *ipc = nullptr;
+    TaskScheduler *scheduler = nullptr;
+    PriorityStrategy *strategy = nullptr;
+    uint32_t traps = 0;
+    uint32_t parked = 0;
+    ITaskControlBlock *dispatched_on = nullptr;
+
+    void yield_current_task() override {}
+    void terminate_current_task() override {}
+    void block_current_task() override {}
+    void invoke_ipc(SignalEvent op) override
+    {
+        traps++;
+        ITaskControlBlock *caller = scheduler->get_current();
+        SignalPacket packet{};
+        packet.type = SignalType::Yield;
+        packet.event_id = op;
+        dispatcher->dispatch(packet);
+        if (scheduler->get_current() == caller)
+            return;
+
+        // 切到了空闲任务：它分发积压并唤醒投递者；MockTaskContext 不真正切换，这里手动切回
+        parked++;
+        ITaskControlBlock *idle = scheduler->get_current();
+        bus->dispatch_messages();
+        ipc->wake_publishers();
+        strategy->remove_task(caller);
+        strategy->make_task_ready(idle);
+        scheduler->set_current(caller);
+    }
+};
+
+static void record_dispatch_task(const Message &, void *context)
+{
+    PublishWaitTrap *trap = static_cast<PublishWaitTrap *>(context);
+    if (!trap->dispatched_on)
+        trap->dispatched_on = trap->scheduler->get_current();
+}
+
+/**
+ * 有界队列与反压：容量上限内接收，超出时明确返回 Full 并按类型计数，不向堆申请空间
+ */
+inline void unit_test_message_bus_backpressure()
+{
+    alignas(64) static uint8_t arena[128 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+    auto *bus = builder.construct<MessageBus>(&builder);
+
+    int prints = 0;
+    bus->subscribe(MessageType::EVENT_PRINT, MessageCallback(dispatch_table_count, &prints));
+    K_T_ASSERT(!bus->set_lane_capacity(MessageLane::Bulk, MessageBus::QUEUE_CAPACITY + 1) &&
+                   bus->set_lane_capacity(MessageLane::Bulk, 4),
+               "Lane capacity validation wrong");
+
+    // 1. 超出上限：Full，按车道与类型计数，其他车道不受影响
+    Message print{};
+    print.type = MessageType::EVENT_PRINT;
+    bool accepted = true;
+    for (int i = 0; i < 4; ++i)
+        accepted = accepted && bus->publish(print) == PublishResult::Ok;
+    K_T_ASSERT(accepted && !bus->has_room(MessageType::EVENT_PRINT), "Lane must accept up to its capacity");
+    K_T_ASSERT(bus->publish(print) == PublishResult::Full, "Publish past capacity must report Full");
+
+    Message key{};
+    key.type = MessageType::EVENT_KEYBOARD;
+    K_T_ASSERT(bus->has_room(key.type) && bus->publish(key) == PublishResult::Ok, "Other lanes must keep accepting");
+
+    K_T_ASSERT(bus->type_stats(MessageType::EVENT_PRINT).dropped == 1, "Per-type drop counter wrong");
+    K_T_ASSERT(bus->lane_stats(MessageLane::Bulk).capacity == 4 && bus->dropped_count() == 1, "Lane counters wrong");
+
+    // 2. 分发后记录按类型的积压高水位；批量投递在上限处截断
+    Message burst[3] = {print, print, print};
+    bus->dispatch_messages();
+    MessageTypeStats stats = bus->type_stats(MessageType::EVENT_PRINT);
+    K_T_ASSERT(prints == 4 && stats.high_water == 4, "Per-type high-water mark wrong");
+    K_T_ASSERT(bus->type_stats(MessageType::EVENT_KEYBOARD).high_water == 1, "High-water marks must be tracked per type");
+    bus->publish(print);
+    bus->publish(print);
+    K_T_ASSERT(bus->publish_batch(burst, 3) == 2 && bus->type_stats(MessageType::EVENT_PRINT).dropped == 2, "Batch must stop at capacity");
+
+    // 3. 阻塞投递：投递者阻塞，分发在空闲任务上进行，腾出空间后投递者被唤醒并重试成功
+    MockTaskContext ctx_pub, ctx_idle;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock publisher(1, &ctx_pub, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock idle(2, &ctx_idle, exec, TaskResourceConfig(TaskPriority::IDLE, nullptr));
+
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    PriorityStrategy strategy;
+    PrioritySchedulingPolicy policy;
+    TaskScheduler scheduler(&strategy, &policy);
+    IpcService ipc(&lifecycle, &scheduler);
+    ipc.set_bus(bus);
+    SignalDispatcher dispatcher(scheduler, 10, &ipc);
+
+    PublishWaitTrap trap;
+    trap.dispatcher = &dispatcher;
+    trap.bus = bus;
+    trap.ipc = &ipc;
+    trap.scheduler = &scheduler;
+    trap.strategy = &strategy;
+    PlatformHooks hooks{};
+    hooks.sched_control = &trap;
+    KernelRuntimeProxy proxy(bus, &hooks, &scheduler, &ipc);
+
+    scheduler.set_current(&publisher);
+    strategy.make_task_ready(&idle);
+    K_T_ASSERT(proxy.publish(print) == PublishResult::Full, "Non-blocking publish must not wait");
+
+    bus->subscribe(MessageType::EVENT_PRINT, MessageCallback(record_dispatch_task, &trap));
+    K_T_ASSERT(proxy.publish_wait(print) == PublishResult::Ok && prints == 8, "Blocking publish must succeed once the lane drains");
+    K_T_ASSERT(trap.parked == 1 && trap.dispatched_on == &idle, "Publisher must block while callbacks run on the dispatcher");
+    K_T_ASSERT(scheduler.get_current() == &publisher && !ipc.wake_publishers(), "Publisher must be woken by the dispatcher");
+
+    // 车道有空间时不陷入
+    K_T_ASSERT(proxy.publish_wait(print) == PublishResult::Ok && trap.traps == 1, "Publish with room must not trap");
+
+    // 没有 IPC 陷入时不阻塞，直接报告 Full
+    bus->publish(print);
+    bus->publish(print);
+    KernelRuntimeProxy no_trap(bus, &hooks, &scheduler);
+    K_T_ASSERT(no_trap.publish_wait(print) == PublishResult::Full && prints == 8, "Publish without a trap must not dispatch");
+
+    // 没有总线时无处投递
+    KernelRuntimeProxy detached(nullptr, &hooks);
+    K_T_ASSERT(detached.publish(print) == PublishResult::Dropped, "Publish without a bus must be dropped");
+
+    bus->dispatch_messages();
+    builder.destroy(bus);
+}
@@ -0,0 +1,166 @@
+// unit/test_mpsc_ring.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <thread>
+#include <vector>
+#include <kernel/MpscRing.hpp>
+#include <kernel/MessageBus.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+
+inline void unit_test_mpsc_ring_bounds()
+{
+    MpscRing<Message, 8> ring;
+    Message msg{};
+
+    // 1. 写满后立即拒绝，不阻塞
+    for (uint64_t i = 0; i < 8; ++i)
+    {
+        msg.payload[0] = i;
+        K_T_ASSERT(ring.try_push(msg), "Ring rejected a push below capacity");
+    }
+    K_T_ASSERT(!ring.try_push(msg), "Full ring must reject the push");
+
+    // 2. FIFO 取出，取出后槽位可以复用（跨圈）
+    Message out{};
+    K_T_ASSERT(ring.try_pop(out) && out.payload[0] == 0, "FIFO order broken");
+    msg.payload[0] = 8;
+    K_T_ASSERT(ring.try_push(msg), "Released slot must be reusable");
+
+    uint64_t expected = 1;
+    bool ordered = true;
+    size_t drained = ring.drain([&](const Message &m)
+                                { ordered = ordered && m.payload[0] == expected++; });
+    K_T_ASSERT(drained == 8 && ordered, "Batch drain lost or reordered messages");
+    K_T_ASSERT(!ring.has_pending(), "Drained ring must be empty");
+
+    // 3. 批量入队：一次占下整段；空间不足时只写入能放下的前缀
+    Message batch[6] = {};
+    for (uint64_t i = 0; i < 6; ++i)
+        batch[i].payload[0] = 100 + i;
+    K_T_ASSERT(ring.try_push_batch(batch, 6) == 6, "Batch push below capacity must be whole");
+    K_T_ASSERT(ring.try_push_batch(batch, 6) == 2, "Batch push must truncate to the free space");
+    K_T_ASSERT(ring.try_push_batch(batch, 1) == 0, "Batch push into a full ring must fail");
+
+    const uint64_t expected_batch[8] = {100, 101, 102, 103, 104, 105, 100, 101};
+    size_t index = 0;
+    ordered = true;
+    ring.drain([&](const Message &m)
+               { ordered = ordered && m.payload[0] == expected_batch[index++]; });
+    K_T_ASSERT(index == 8 && ordered, "Batch push lost or reordered messages");
+}
+
+/**
+ * 压力测试：多个宿主线程并发投递，单消费者同时批量取出
+ * 校验：无丢失、无重复、每个生产者内部保持 FIFO
+ */
+inline void unit_test_mpsc_ring_stress()
+{
+    const int PRODUCERS = 4;
+    const uint64_t PER_PRODUCER = 50000;
+
+    static MpscRing<Message, 256> ring;
+    std::atomic<int> finished{0};
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([p, &finished]()
+                               {
+            Message msg{};
+            msg.type = MessageType::EVENT_PRINT;
+            msg.payload[0] = static_cast<uint64_t>(p);
+            // 奇数号生产者走批量入队，与单条入队的生产者交错争用
+            Message batch[8];
+            for (uint64_t seq = 0; seq < PER_PRODUCER;)
+            {
+                size_t want = (p & 1) ? 8 : 1;
+                if (want > PER_PRODUCER - seq)
+                    want = PER_PRODUCER - seq;
+                for (size_t i = 0; i < want; ++i)
+                {
+                    batch[i] = msg;
+                    batch[i].payload[1] = seq + i;
+                }
+
+                // 队列满时让出宿主 CPU，等待消费者追上
+                size_t pushed = ring.try_push_batch(batch, want);
+                if (!pushed)
+                    std::this_thread::yield();
+                seq += pushed;
+            }
+            finished.fetch_add(1); });
+    }
+
+    uint64_t next_seq[PRODUCERS] = {};
+    uint64_t received = 0;
+    bool ordered = true;
+
+    auto consume = [&](const Message &m)
+    {
+        uint64_t p = m.payload[0];
+        ordered = ordered && p < PRODUCERS && m.payload[1] == next_seq[p];
+        if (p < PRODUCERS)
+            next_seq[p] = m.payload[1] + 1;
+        received++;
+    };
+
+    while (finished.load() < PRODUCERS || ring.has_pending())
+    {
+        if (!ring.drain(consume))
+            std::this_thread::yield();
+    }
+
+    for (auto &t : producers)
+        t.join();
+
+    K_T_ASSERT(ordered, "Per-producer FIFO order violated");
+    K_T_ASSERT(received == PRODUCERS * PER_PRODUCER, "Messages lost or duplicated");
+}
+
+/**
+ * MessageBus 层面：宿主线程投递与内核分发并发进行
+ */
+inline void unit_test_message_bus_concurrent_publish()
+{
+    alignas(64) static uint8_t arena[128 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+    auto *bus = builder.construct<MessageBus>(&builder);
+
+    static uint64_t delivered;
+    delivered = 0;
+    bus->subscribe(MessageType::EVENT_KEYBOARD, MessageCallback([](const Message &, void *)
+                                                                { delivered++; },
+                                                                nullptr));
+
+    const int PRODUCERS = 3;
+    const uint64_t PER_PRODUCER = 20000;
+    std::atomic<int> finished{0};
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&]()
+                               {
+            Message msg{};
+            msg.type = MessageType::EVENT_KEYBOARD;
+            for (uint64_t i = 0; i < PER_PRODUCER; ++i)
+                bus->publish(msg);
+            finished.fetch_add(1); });
+    }
+
+    while (finished.load() < PRODUCERS || bus->has_pending())
+        bus->dispatch_messages();
+
+    for (auto &t : producers)
+        t.join();
+    bus->dispatch_messages();
+
+    // 满队列丢弃的消息全部计入 dropped_count
+    K_T_ASSERT(delivered + bus->dropped_count() == PRODUCERS * PER_PRODUCER, "Published messages unaccounted for");
+
+    builder.destroy(bus);
+}
@@ -0,0 +1,114 @@
+// unit/test_notification.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/IpcService.hpp>
+#include <kernel/Notification.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/SignalDispatcher.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include "mock/MockTaskContext.hpp"
+
+/**
+ * 通知对象：信号位累积、取走即清空，等待者经 Wait 陷入阻塞并由 notify 直接交付
+ */
+inline void unit_test_notification_signal_wait()
+{
+    alignas(64) static uint8_t arena[32 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+
+    MockTaskContext ctx_waiter, ctx_other;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock waiter(1, &ctx_waiter, exec, TaskResourceConfig(TaskPriority::HIGH, nullptr));
+    SimpleTaskControlBlock other(2, &ctx_other, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    lifecycle.register_task(&waiter);
+    lifecycle.register_task(&other);
+
+    PriorityStrategy strategy;
+    PrioritySchedulingPolicy policy;
+    TaskScheduler scheduler(&strategy, &policy);
+    static NotificationTable table;
+    IpcService ipc(&lifecycle, &scheduler, nullptr, &table);
+    SignalDispatcher dispatcher(scheduler, 10, &ipc);
+
+    auto wait = [&](uint32_t handle)
+    {
+        scheduler.get_current()->ipc.partner = handle;
+        SignalPacket packet{};
+        packet.type = SignalType::Yield;
+        packet.event_id = SignalEvent::Wait;
+        dispatcher.dispatch(packet);
+    };
+
+    uint32_t handle = table.create();
+    K_T_ASSERT(handle != NotificationTable::INVALID_HANDLE && table.get(handle), "Notification creation failed");
+
+    // 1. 没有等待者：信号位按位或累积，poll 取走并清空
+    K_T_ASSERT(ipc.notify(handle, 0x1) && ipc.notify(handle, 0x4) && ipc.notify(handle, 0x1), "Notify failed");
+    K_T_ASSERT(table.get(handle)->poll() == 0x5 && table.get(handle)->poll() == 0, "Poll must return and clear the accumulated bits");
+
+    // 2. 已有信号时 wait 不阻塞
+    scheduler.set_current(&waiter);
+    ipc.notify(handle, 0x8);
+    wait(handle);
+    K_T_ASSERT(scheduler.get_current() == &waiter && waiter.ipc.bits == 0x8, "Pending bits must be returned without blocking");
+
+    // 3. 没有信号时阻塞；notify 把位直接交给等待者并唤醒它
+    strategy.make_task_ready(&other);
+    wait(handle);
+    K_T_ASSERT(scheduler.get_current() == &other, "Waiter must block when no bits are pending");
+    K_T_ASSERT(waiter.get_state() == TaskState::BLOCKED && waiter.ipc.wait == IpcWait::Notification, "Waiter must be parked on the notification");
+    K_T_ASSERT(!table.destroy(handle), "Notification with waiters must not be destroyed");
+
+    K_T_ASSERT(ipc.notify(handle, 0x30), "Notify failed");
+    K_T_ASSERT(waiter.get_state() == TaskState::READY && waiter.ipc.wait == IpcWait::None, "Notify must ready the waiter");
+    K_T_ASSERT(waiter.ipc.bits == 0x30 && table.get(handle)->pending() == 0, "Bits must be delivered to the waiter, not left pending");
+    K_T_ASSERT(scheduler.resched_pending(), "Waking a higher priority waiter must request a reschedule");
+
+    // 4. 无效句柄：notify 失败，wait 立即返回零
+    K_T_ASSERT(!ipc.notify(NotificationTable::INVALID_HANDLE, 1) && !ipc.notify(NotificationTable::MAX_NOTIFICATIONS + 1, 1), "Invalid handle must be rejected");
+    scheduler.set_current(&waiter);
+    waiter.ipc.bits = 0xFF;
+    wait(NotificationTable::MAX_NOTIFICATIONS);
+    K_T_ASSERT(scheduler.get_current() == &waiter && waiter.ipc.bits == 0, "Waiting on an invalid handle must return at once");
+
+    // 5. 销毁后句柄失效，槽位可复用
+    K_T_ASSERT(table.destroy(handle) && !table.get(handle) && !ipc.notify(handle, 1), "Destroyed handle must be invalid");
+    K_T_ASSERT(table.create() == handle && table.get(handle)->pending() == 0, "Reused slot must start clear");
+
+    // 6. 中断打断内核临界区：只置位不唤醒，下一个时钟节拍补做唤醒
+    strategy.remove_task(&waiter);
+    strategy.make_task_ready(&other);
+    wait(handle);
+    K_T_ASSERT(scheduler.get_current() == &other && waiter.get_state() == TaskState::BLOCKED, "Waiter must block");
+
+    scheduler.preempt_disable();
+    K_T_ASSERT(ipc.notify_from_irq(handle, 0x2), "IRQ notify failed");
+    K_T_ASSERT(waiter.get_state() == TaskState::BLOCKED && table.get(handle)->pending() == 0x2 && table.get(handle)->waiter_count() == 1,
+               "IRQ notify inside a critical section must not touch the queues");
+
+    SignalPacket tick{};
+    tick.type = SignalType::Interrupt;
+    tick.event_id = SignalEvent::Timer;
+    dispatcher.dispatch(tick);
+    K_T_ASSERT(waiter.get_state() == TaskState::BLOCKED, "Deferred wake must wait until the critical section ends");
+
+    scheduler.preempt_enable();
+    dispatcher.dispatch(tick);
+    K_T_ASSERT(waiter.get_state() != TaskState::BLOCKED && waiter.ipc.wait == IpcWait::None && waiter.ipc.bits == 0x2,
+               "Next tick must deliver the deferred bits");
+    K_T_ASSERT(table.get(handle)->pending() == 0 && ipc.flush_deferred_notifications() == 0, "Deferred wake must be delivered once");
+
+    // 没有打断临界区时立即交付
+    K_T_ASSERT(ipc.notify_from_irq(handle, 0x4) && table.get(handle)->pending() == 0x4, "IRQ notify outside a critical section must signal at once");
+    table.get(handle)->poll();
+    table.destroy(handle);
+}
@@ -0,0 +1,65 @@
+// unit/test_priority_strategy.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/TaskScheduler.hpp>
+
+inline void unit_test_priority_strategy_ordering()
+{
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock idle(0, nullptr, exec, TaskResourceConfig(TaskPriority::IDLE, nullptr));
+    SimpleTaskControlBlock bg(1, nullptr, exec, TaskResourceConfig(TaskPriority::LOW, nullptr));
+    SimpleTaskControlBlock app1(2, nullptr, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock app2(3, nullptr, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock rt(4, nullptr, exec, TaskResourceConfig(TaskPriority::REALTIME, nullptr));
+
+    PriorityStrategy strategy;
+    K_T_ASSERT(strategy.pick_next_ready_task() == nullptr, "Empty strategy should return nullptr");
+    K_T_ASSERT(strategy.highest_ready_level() == -1, "Empty bitmap expected");
+
+    // 入队顺序与优先级无关
+    strategy.make_task_ready(&idle);
+    strategy.make_task_ready(&bg);
+    strategy.make_task_ready(&app1);
+    strategy.make_task_ready(&rt);
+    strategy.make_task_ready(&app2);
+
+    K_T_ASSERT(strategy.highest_ready_level() == static_cast<int>(TaskPriority::REALTIME), "Bitmap top level wrong");
+
+    // 1. 高优先级先出，同级保持 FIFO
+    K_T_ASSERT(strategy.pick_next_ready_task() == &rt, "REALTIME should run first");
+    K_T_ASSERT(strategy.pick_next_ready_task() == &app1, "NORMAL FIFO order broken (app1)");
+
+    // 2. 同级轮转：app1 重新就绪后排在 app2 之后
+    strategy.make_task_ready(&app1);
+    K_T_ASSERT(strategy.pick_next_ready_task() == &app2, "NORMAL FIFO order broken (app2)");
+    K_T_ASSERT(strategy.pick_next_ready_task() == &app1, "Round robin within level broken");
+
+    // 3. remove_task 清空一级后位图同步清零
+    strategy.remove_task(&bg);
+    K_T_ASSERT(strategy.highest_ready_level() == static_cast<int>(TaskPriority::IDLE), "LOW bit not cleared");
+    K_T_ASSERT(strategy.pick_next_ready_task() == &idle, "IDLE should run last");
+    K_T_ASSERT(strategy.pick_next_ready_task() == nullptr, "Strategy should be drained");
+}
+
+inline void unit_test_priority_yield_keeps_higher_task()
+{
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock root(1, nullptr, exec, TaskResourceConfig(TaskPriority::ROOT, nullptr));
+    SimpleTaskControlBlock idle(2, nullptr, exec, TaskResourceConfig(TaskPriority::IDLE, nullptr));
+
+    PriorityStrategy strategy;
+    TaskScheduler scheduler(&strategy, nullptr);
+
+    strategy.make_task_ready(&idle);
+    scheduler.set_current(&root);
+
+    // 当前任务优先级更高：yield 后仍由它继续运行，不会丢失也不会重复入队
+    scheduler.yield_current();
+    K_T_ASSERT(scheduler.get_current() == &root, "Higher priority task must keep the CPU on yield");
+    K_T_ASSERT(!root.sched_link.is_linked(), "Running task must not stay in the ready queue");
+    K_T_ASSERT(idle.sched_link.is_linked(), "Idle task should remain ready");
+}
@@ -0,0 +1,109 @@
+// unit/test_slab_cache.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KSlabCache.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include <kernel/KList.hpp>
+#include <inspect/HeapInspector.hpp>
+#include <vector>
+
+struct SlabProbe
+{
+    static constexpr bool SLAB_CACHED = true;
+
+    uint64_t payload[5];
+    SlabProbe(uint64_t v) { payload[0] = v; }
+};
+
+struct HeapProbe
+{
+    uint64_t payload[5];
+};
+
+inline void unit_test_slab_cache_routing()
+{
+    static uint8_t arena[256 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    HeapInspector<TlsfHeapAllocator> hi(&heap);
+    KSlabCacheTable caches(&heap);
+    KernelObjectBuilder builder(&heap, &caches);
+
+    const size_t initial_free = hi.get_free_size();
+
+    // 1. 声明了 SLAB_CACHED 的类型：对象紧密排列，无堆头
+    std::vector<SlabProbe *> objs;
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        auto *obj = builder.construct<SlabProbe>(i);
+        K_T_ASSERT(obj != nullptr, "Slab construct failed at " << i);
+        K_T_ASSERT(obj->payload[0] == i, "Constructor not invoked");
+        objs.push_back(obj);
+    }
+
+    KSlabCache *cache = caches.find(&ObjectTypeTag<SlabProbe>::id);
+    K_T_ASSERT(cache != nullptr, "No per-type cache created for SlabProbe");
+    K_T_ASSERT(cache->object_size() == sizeof(SlabProbe), "Slab object stride should equal sizeof(T)");
+    K_T_ASSERT(reinterpret_cast<uintptr_t>(objs[1]) - reinterpret_cast<uintptr_t>(objs[0]) == sizeof(SlabProbe),
+               "Consecutive objects are not densely packed");
+
+    // 100 个对象只应占用少量 slab，而不是 100 次堆分配
+    size_t per_slab = (cache->slab_size() - 64) / sizeof(SlabProbe);
+    K_T_ASSERT(cache->slab_count() <= (100 + per_slab - 1) / per_slab + 1, "Too many slabs: " << cache->slab_count());
+
+    // 2. 未声明的类型仍走堆，且不会建立缓存
+    auto *plain = builder.construct<HeapProbe>();
+    K_T_ASSERT(plain != nullptr, "Heap construct failed");
+    K_T_ASSERT(caches.find(&ObjectTypeTag<HeapProbe>::id) == nullptr, "Non-cached type must not get a slab cache");
+    builder.destroy(plain);
+
+    // 3. 全部释放：空 slab 只保留一个热备，reclaim 后堆完全恢复
+    for (auto *obj : objs)
+        builder.destroy(obj);
+    // 最多保留：热备空 slab + 留在原处的当前分配 slab
+    K_T_ASSERT(cache->slab_count() <= KSlabCache::EMPTY_SLABS_KEPT + 1, "Empty slabs were not returned to heap");
+
+    caches.reclaim();
+    K_T_ASSERT(cache->slab_count() == 0, "Reclaim left slabs behind");
+    K_T_ASSERT(hi.get_free_size() == initial_free, "Heap not fully restored after reclaim");
+}
+
+inline void unit_test_slab_cache_list_nodes()
+{
+    static uint8_t arena[128 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KSlabCacheTable caches(&heap);
+    KernelObjectBuilder builder(&heap, &caches);
+
+    // ListNode 声明了 SLAB_CACHED：KList 的节点应来自同一个 slab 缓存
+    KList<uint32_t> list(&builder);
+    for (uint32_t i = 0; i < 64; ++i)
+        list.push_back(i);
+
+    KSlabCache *cache = caches.find(&ObjectTypeTag<ListNode<uint32_t>>::id);
+    K_T_ASSERT(cache != nullptr, "KList nodes did not use a slab cache");
+
+    uint32_t expected = 0;
+    for (auto v : list)
+        K_T_ASSERT(v == expected++, "List content corrupted");
+
+    // 交错删除与插入，验证 partial / full 链表切换
+    list.remove_match([](uint32_t v)
+                      { return v % 2 == 0; });
+    for (uint32_t i = 100; i < 132; ++i)
+        list.push_back(i);
+
+    size_t count = 0;
+    for (auto v : list)
+    {
+        (void)v;
+        count++;
+    }
+    K_T_ASSERT(count == 64, "Unexpected node count " << count);
+
+    list.clear();
+    caches.reclaim();
+    K_T_ASSERT(cache->slab_count() == 0, "List node slabs leaked");
+}
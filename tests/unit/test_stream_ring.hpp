@@ -0,0 +1,102 @@
+// unit/test_stream_ring.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <common/StreamRing.hpp>
+#include <kernel/KernelProxy.hpp>
+#include <kernel/IpcService.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include "mock/MockTaskContext.hpp"
+
+/**
+ * 流通道：内核建环并交付两端，稳态读写不进入内核，只在对端等待时发出通知
+ */
+inline void unit_test_stream_ring_spsc()
+{
+    alignas(64) static uint8_t arena[32 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+
+    alignas(64) static uint8_t pool[16 * 1024];
+    static BufferGrantTable grants(pool, sizeof(pool));
+    static NotificationTable notes;
+
+    MockTaskContext ctx_p, ctx_c;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock producer(1, &ctx_p, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock consumer(2, &ctx_c, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    lifecycle.register_task(&producer);
+    lifecycle.register_task(&consumer);
+    PriorityStrategy strategy;
+    TaskScheduler scheduler(&strategy, nullptr);
+    IpcService ipc(&lifecycle, &scheduler, &grants, &notes);
+
+    PlatformHooks hooks{};
+    KernelRuntimeProxy proxy(nullptr, &hooks, &scheduler, &ipc);
+
+    // 1. 建环：容量须为 2 的幂
+    scheduler.set_current(&producer);
+    K_T_ASSERT(proxy.stream_create(sizeof(uint32_t), 6) == 0 && proxy.stream_create(0, 8) == 0, "Invalid ring geometry must be rejected");
+    K_T_ASSERT(proxy.stream_create(0x10000, 0x10000) == 0 && grants.live_count() == 0, "Ring size overflowing 32 bits must be rejected");
+    uint32_t handle = proxy.stream_create(sizeof(uint32_t), 8);
+    K_T_ASSERT(handle && notes.live_count() == 2, "Ring creation must allocate a grant and two notifications");
+
+    // 2. 创建者保留一份引用后把授权交给消费者
+    Message share{};
+    share.grant = handle;
+    K_T_ASSERT(proxy.grant_retain(handle) && proxy.send(consumer.get_id(), share), "Handing the ring to the consumer failed");
+
+    StreamWriter<uint32_t> writer(&proxy, handle);
+    K_T_ASSERT(writer.valid() && !StreamWriter<uint64_t>(&proxy, handle).valid(), "Endpoint must check the element size");
+
+    scheduler.set_current(&consumer);
+    StreamReader<uint32_t> reader(&proxy, handle);
+    K_T_ASSERT(reader.valid(), "Consumer must map the shared ring");
+
+    // 环头在共享内存里：被改写成回绕的容量时拒绝映射
+    auto *shared = static_cast<StreamRingHeader *>(grants.map(handle, consumer.get_id()));
+    shared->capacity = 0x40000000;
+    K_T_ASSERT(!StreamReader<uint32_t>(&proxy, handle).valid(), "Forged ring capacity must be rejected");
+    shared->capacity = 8;
+
+    // 3. 批量写满后只接受容量内的部分，读出顺序不变；多轮绕回
+    uint32_t in[12], out[12];
+    for (uint32_t i = 0; i < 12; ++i)
+        in[i] = 100 + i;
+
+    for (int round = 0; round < 3; ++round)
+    {
+        size_t written = writer.try_write(in, 12);
+        K_T_ASSERT(written == 8 && !writer.try_write(in[0]), "Full ring must accept exactly its capacity");
+
+        size_t got = reader.try_read(out, 5) + reader.try_read(out + 5, 12);
+        K_T_ASSERT(got == 8 && !reader.try_read(out[0]), "Reader must drain what was written");
+        for (uint32_t i = 0; i < 8; ++i)
+            K_T_ASSERT(out[i] == in[i], "Stream order broken");
+    }
+
+    // 4. 稳态不发通知；对端挂起时发布游标后唤醒它
+    auto *ring = static_cast<StreamRingHeader *>(grants.map(handle, consumer.get_id()));
+    writer.try_write(in[0]);
+    K_T_ASSERT(notes.get(ring->data_note)->pending() == 0, "Steady-state writes must not notify");
+
+    ring->consumer_waiting.store(1);
+    writer.try_write(in[1]);
+    K_T_ASSERT(notes.get(ring->data_note)->poll() && !ring->consumer_waiting.load(), "Write must wake a parked consumer once");
+
+    ring->producer_waiting.store(1);
+    K_T_ASSERT(reader.try_read(out, 12) == 2, "Queued items lost");
+    K_T_ASSERT(notes.get(ring->space_note)->poll() && !ring->producer_waiting.load(), "Read must wake a parked producer");
+
+    // 5. 销毁：通知对象归还，授权随最后一个引用释放
+    K_T_ASSERT(proxy.stream_destroy(handle) && notes.live_count() == 0, "Destroy must free the notifications");
+    scheduler.set_current(&producer);
+    K_T_ASSERT(!proxy.stream_destroy(handle) && proxy.grant_release(handle), "Ring must be destroyed only once");
+    K_T_ASSERT(grants.live_count() == 0, "Ring buffer must return to the pool");
+}
@@ -9,7 +9,7 @@
 
 void unit_test_task_creation_integrity()
 {
-    Mock mock(32 * 1024);
+    Mock mock(8 * 1024 * 1024); // 容纳缓冲授权池（GRANT_POOL_SIZE），经总线创建任务时载荷走授权
     Kernel *kernel = mock.kernel();
 
     KernelInspector ki(kernel);
@@ -34,5 +34,38 @@ void unit_test_task_creation_integrity()
     strategy->make_task_ready(tcb);
     K_T_ASSERT(tcb->get_state() == TaskState::READY, "Task state is not READY.");
 
+    // 经 TaskService 创建：亲和性与在线 CPU 取交集，不含任何在线 CPU 的任务被拒绝
+    TaskService *service = ki.task_service();
+    TaskPlacementStats before = ki.placement_stats();
+    TaskSpawnParams params{exec, res};
+    params.res_config.affinity = cpu_mask_of(3);
+    K_T_ASSERT(service->spawn(params) == nullptr && service->rejected_spawn_count() == 1, "Spawn on an offline CPU must be rejected");
+
+    params.res_config.affinity = cpu_mask_of(0) | cpu_mask_of(2);
+    ITaskControlBlock *pinned = service->spawn(params);
+    K_T_ASSERT(pinned && pinned->get_resource_config().affinity == TaskService::ONLINE_CPUS, "Affinity must be masked to the online CPUs");
+
+    TaskPlacementStats after = ki.placement_stats();
+    K_T_ASSERT(after.tasks == before.tasks + 1 && after.pinned == before.pinned + 1,
+               "Placement stats must count the new pinned task");
+
+    // 绕过 TaskService 创建的任务同样受约束：调度策略不让亲和性不含在线 CPU 的任务归队
+    TaskResourceConfig offline_res = res;
+    offline_res.affinity = cpu_mask_of(3);
+    ITaskControlBlock *offline = lifecycle->spawn_task(exec, offline_res);
+    K_T_ASSERT(offline != nullptr, "Offline-pinned task is null.");
+    strategy->make_task_ready(offline);
+    K_T_ASSERT(!offline->sched_link.is_linked(), "Strategy must not queue a task with no online CPU in its affinity");
+    lifecycle->destroy_task(offline);
+
+    // 经总线创建：载荷超出 payload，TaskSpawnChannel 把它放进缓冲授权，分发后授权归还
+    KernelRuntimeProxy proxy(ki.bus(), ki.hooks(), ki.scheduler(), ki.ipc());
+    ki.scheduler()->set_current(tcb);
+    size_t tasks = lifecycle->get_task_count();
+    params.res_config.priority = TaskPriority::HIGH;
+    K_T_ASSERT(TaskSpawnChannel::publish(&proxy, params) == PublishResult::Ok, "Spawn request must be published");
+    ki.bus()->dispatch_messages();
+    K_T_ASSERT(lifecycle->get_task_count() == tasks + 1 && ki.grants()->live_count() == 0, "Spawn request must create the task and release its grant");
+
     std::cout << "[PASS] create_kernel_task logic is sound." << std::endl;
 }
\ No newline at end of file
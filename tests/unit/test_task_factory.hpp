@@ -43,6 +43,17 @@ inline void unit_test_task_factory_integrity()
     ITaskControlBlock *tcb = factory->create_tcb(exec, res);
 
     K_T_ASSERT(tcb != nullptr, "Factory failed to create TCB");
+    K_T_ASSERT(tcb->mailbox.capacity() == Mailbox::INLINE_CAPACITY && !tcb->mailbox.external_storage(),
+               "Default mailbox must use the inline slots");
+
+    // 6. 按配置分配信箱槽位；容量不是 2 的幂时创建失败
+    TaskResourceConfig deep{TaskPriority::NORMAL, stack, CPU_MASK_ALL, 16};
+    ITaskControlBlock *server = factory->create_tcb(exec, deep);
+    K_T_ASSERT(server && server->mailbox.capacity() == 16 && server->mailbox.limit() == 16 && server->mailbox.external_storage(),
+               "Configured mailbox capacity must be allocated per task");
+
+    TaskResourceConfig odd{TaskPriority::NORMAL, stack, CPU_MASK_ALL, 12};
+    K_T_ASSERT(factory->create_tcb(exec, odd) == nullptr, "Non power-of-two mailbox capacity must be rejected");
 
     std::cout << "[PASS] SimpleTaskFactory integrity verified." << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,125 @@
+// unit/test_timer_wheel.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <new>
+
+#include <kernel/TimerWheel.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/SignalDispatcher.hpp>
+#include <kernel/TaskScheduler.hpp>
+#include "mock/MockTaskContext.hpp"
+
+/**
+ * 时间轮：各层的截止时间都恰好在到期那一毫秒交出，取消 O(1)
+ */
+inline void unit_test_timer_wheel_expiry()
+{
+    const uint64_t deadlines[] = {1, 63, 64, 65, 4095, 4096, 4200, 300000, TimerWheel::SPAN + 10};
+    const size_t COUNT = sizeof(deadlines) / sizeof(deadlines[0]);
+
+    MockTaskContext ctx[COUNT + 1];
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock *tasks[COUNT + 1];
+    alignas(SimpleTaskControlBlock) static uint8_t storage[COUNT + 1][sizeof(SimpleTaskControlBlock)];
+    for (size_t i = 0; i <= COUNT; ++i)
+        tasks[i] = new (storage[i]) SimpleTaskControlBlock(i + 1, &ctx[i], exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+
+    static TimerWheel wheel;
+    for (size_t i = 0; i < COUNT; ++i)
+        wheel.schedule(tasks[i], deadlines[i]);
+    K_T_ASSERT(wheel.size() == COUNT, "Schedule count wrong");
+
+    // 1. 重复 schedule 只移动位置；cancel 摘除
+    SimpleTaskControlBlock *extra = tasks[COUNT];
+    wheel.schedule(extra, 100);
+    wheel.schedule(extra, 200);
+    K_T_ASSERT(wheel.size() == COUNT + 1 && wheel.cancel(extra) && !wheel.cancel(extra), "Reschedule/cancel bookkeeping wrong");
+
+    // 2. 每个任务都在截止的那一毫秒到期，不早不晚
+    uint64_t expired_at[COUNT] = {};
+    size_t expired = 0;
+    auto on_expire = [&](ITaskControlBlock *task)
+    {
+        expired_at[task->get_id() - 1] = wheel.now();
+        expired++;
+    };
+
+    wheel.advance(1, on_expire);
+    wheel.advance(4199, on_expire); // 大步推进与逐毫秒等价
+    K_T_ASSERT(expired == 7, "Short timers must have fired");
+    wheel.advance(TimerWheel::SPAN + 10 - wheel.now(), on_expire);
+
+    K_T_ASSERT(expired == COUNT && wheel.empty(), "Every timer must fire exactly once");
+    for (size_t i = 0; i < COUNT; ++i)
+        K_T_ASSERT(expired_at[i] == deadlines[i], "Timer fired at the wrong tick");
+
+    // 3. 过去的截止时间按下一毫秒处理
+    wheel.schedule(extra, 0);
+    size_t late = 0;
+    wheel.advance(1, [&](ITaskControlBlock *)
+                  { late++; });
+    K_T_ASSERT(late == 1, "Past deadline must fire on the next tick");
+}
+
+/**
+ * 睡眠：经陷入转入 SLEEPING，时钟节拍推进到截止时间后回到就绪队列
+ */
+inline void unit_test_scheduler_sleep()
+{
+    MockTaskContext ctx_sleeper, ctx_worker;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock sleeper(1, &ctx_sleeper, exec, TaskResourceConfig(TaskPriority::HIGH, nullptr));
+    SimpleTaskControlBlock worker(2, &ctx_worker, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+
+    PriorityStrategy strategy;
+    PrioritySchedulingPolicy policy;
+    TaskScheduler scheduler(&strategy, &policy);
+    SignalDispatcher dispatcher(scheduler, 10);
+
+    auto sleep_until = [&](uint64_t deadline)
+    {
+        scheduler.get_current()->wake_at_ms = deadline;
+        SignalPacket packet{};
+        packet.type = SignalType::Yield;
+        packet.event_id = SignalEvent::Sleep;
+        dispatcher.dispatch(packet);
+    };
+    auto tick = [&]()
+    {
+        SignalPacket packet{};
+        packet.type = SignalType::Interrupt;
+        packet.event_id = SignalEvent::Timer;
+        dispatcher.dispatch(packet);
+    };
+
+    strategy.make_task_ready(&worker);
+    scheduler.set_current(&sleeper);
+
+    // 1. 截止时间已过：不睡眠
+    sleep_until(0);
+    K_T_ASSERT(scheduler.get_current() == &sleeper && !scheduler.has_sleepers(), "Expired deadline must not sleep");
+
+    // 2. 睡眠 25 ms：切给 worker，不在就绪队列上
+    sleep_until(25);
+    K_T_ASSERT(scheduler.get_current() == &worker && sleeper.get_state() == TaskState::SLEEPING, "Sleeper must leave the CPU");
+    K_T_ASSERT(!sleeper.sched_link.is_linked() && scheduler.has_sleepers(), "Sleeper must wait on the timer wheel only");
+
+    tick();
+    tick();
+    K_T_ASSERT(sleeper.get_state() == TaskState::SLEEPING && scheduler.now_ms() == 20, "Sleeper must not wake early");
+
+    // 3. 临界区内到达的节拍只记账，离开后下一个节拍补齐
+    scheduler.preempt_disable();
+    tick();
+    K_T_ASSERT(sleeper.get_state() == TaskState::SLEEPING && scheduler.now_ms() == 20, "Timer wheel must not run inside a critical section");
+    scheduler.preempt_enable();
+
+    // 4. 到期：回到就绪队列，高优先级的睡眠者立即抢占
+    tick();
+    K_T_ASSERT(scheduler.now_ms() == 40 && !scheduler.has_sleepers(), "Backlog must be caught up");
+    K_T_ASSERT(scheduler.get_current() == &sleeper && sleeper.get_state() == TaskState::READY, "Woken sleeper must preempt the lower priority task");
+}
@@ -0,0 +1,83 @@
+// unit/test_tlsf_heap.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <inspect/HeapInspector.hpp>
+#include <vector>
+
+inline void unit_test_tlsf_heap_alloc_free_coalesce()
+{
+    // 1. 准备一块未对齐的原始内存，验证构造时的对齐修正
+    static uint8_t arena[256 * 1024];
+    TlsfHeapAllocator heap(arena + 8, sizeof(arena) - 8);
+    HeapInspector<TlsfHeapAllocator> hi(&heap);
+
+    const size_t initial_free = hi.get_free_size();
+    K_T_ASSERT(initial_free > 0, "TLSF heap has no free space after init");
+    K_T_ASSERT(hi.get_block_count() == 1, "Fresh heap should be a single free block");
+
+    // 2. 混合尺寸分配：有效载荷必须 16 字节对齐且互不重叠
+    const size_t sizes[] = {1, 16, 24, 100, 255, 256, 257, 1000, 4096, 12345};
+    std::vector<uint8_t *> ptrs;
+    for (size_t size : sizes)
+    {
+        auto *p = static_cast<uint8_t *>(heap.allocate(size));
+        K_T_ASSERT(p != nullptr, "TLSF allocate failed for size " << size);
+        K_T_ASSERT((reinterpret_cast<uintptr_t>(p) & 0xF) == 0, "Payload not 16-byte aligned, size " << size);
+        for (size_t i = 0; i < size; ++i)
+            p[i] = static_cast<uint8_t>(size);
+        ptrs.push_back(p);
+    }
+
+    for (size_t i = 0; i < ptrs.size(); ++i)
+    {
+        for (size_t j = 0; j < sizes[i]; ++j)
+            K_T_ASSERT(ptrs[i][j] == static_cast<uint8_t>(sizes[i]), "Block " << i << " was overwritten");
+    }
+
+    // 3. 大对齐请求（如页对齐的栈）
+    void *page = heap.allocate(8192, 4096);
+    K_T_ASSERT(page != nullptr, "Aligned allocation failed");
+    K_T_ASSERT((reinterpret_cast<uintptr_t>(page) & 0xFFF) == 0, "Payload not 4096-byte aligned");
+
+    // 4. 隔位释放，再释放其余块：边界标记合并后应回到单一空闲块
+    for (size_t i = 0; i < ptrs.size(); i += 2)
+        heap.deallocate(ptrs[i], sizes[i]);
+    K_T_ASSERT(hi.get_block_count() > 1, "Interleaved free should leave fragments");
+
+    for (size_t i = 1; i < ptrs.size(); i += 2)
+        heap.deallocate(ptrs[i], sizes[i]);
+    heap.deallocate(page, 8192);
+
+    K_T_ASSERT(hi.get_block_count() == 1, "Neighbors were not merged, blocks: " << hi.get_block_count());
+    K_T_ASSERT(hi.get_free_size() == initial_free, "Free size mismatch after full release");
+    K_T_ASSERT(hi.get_used_size() == 0, "Used size should be zero after full release");
+}
+
+inline void unit_test_tlsf_heap_exhaustion_and_reuse()
+{
+    static uint8_t arena[64 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    HeapInspector<TlsfHeapAllocator> hi(&heap);
+
+    // 1. 超出容量的请求必须失败而不是越界
+    K_T_ASSERT(heap.allocate(sizeof(arena)) == nullptr, "Oversized allocation should fail");
+
+    // 2. 分配到耗尽
+    std::vector<void *> ptrs;
+    while (void *p = heap.allocate(512))
+        ptrs.push_back(p);
+    K_T_ASSERT(ptrs.size() > 64, "Too few blocks before exhaustion: " << ptrs.size());
+
+    // 3. 释放一个块后，同尺寸请求应复用它
+    void *victim = ptrs[ptrs.size() / 2];
+    heap.deallocate(victim, 512);
+    void *again = heap.allocate(512);
+    K_T_ASSERT(again == victim, "Freed block was not reused");
+
+    for (void *p : ptrs)
+        heap.deallocate(p, 512);
+    K_T_ASSERT(hi.get_block_count() == 1, "Heap did not coalesce back to one block");
+}
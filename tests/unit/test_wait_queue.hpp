@@ -0,0 +1,167 @@
+// unit/test_wait_queue.hpp
+#pragma once
+
+#include "test_framework.hpp"
+
+#include <kernel/WaitQueue.hpp>
+#include <kernel/PriorityStrategy.hpp>
+#include <kernel/PrioritySchedulingPolicy.hpp>
+#include <kernel/SimpleTaskControlBlock.hpp>
+#include <kernel/TaskScheduler.hpp>
+#include <kernel/TaskService.hpp>
+#include <kernel/BufferGrantTable.hpp>
+#include <kernel/MessageBus.hpp>
+#include <kernel/SimpleTaskLifecycle.hpp>
+#include <kernel/TlsfHeapAllocator.hpp>
+#include <kernel/KernelObjectBuilder.hpp>
+#include "mock/MockTaskContext.hpp"
+
+/**
+ * 等待队列：先进先出地阻塞与唤醒，限时等待到期后自动离队
+ * MockTaskContext 的切换为空操作，block_on 在“切走”后立即返回
+ */
+inline void unit_test_wait_queue_block_wake()
+{
+    MockTaskContext ctx_a, ctx_b, ctx_c, ctx_idle;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock a(1, &ctx_a, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock b(2, &ctx_b, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock c(3, &ctx_c, exec, TaskResourceConfig(TaskPriority::HIGH, nullptr));
+    SimpleTaskControlBlock idle(4, &ctx_idle, exec, TaskResourceConfig(TaskPriority::IDLE, nullptr));
+
+    PriorityStrategy strategy;
+    PrioritySchedulingPolicy policy;
+    TaskScheduler scheduler(&strategy, &policy);
+    WaitQueue queue;
+
+    // 1. 依次阻塞：离开就绪队列，按到达顺序排队
+    strategy.make_task_ready(&b);
+    strategy.make_task_ready(&idle);
+    scheduler.set_current(&a);
+    K_T_ASSERT(scheduler.block_on(queue) && scheduler.get_current() == &b, "Blocking must switch to the next ready task");
+    K_T_ASSERT(scheduler.block_on(queue) && scheduler.get_current() == &idle, "Second waiter must block too");
+    K_T_ASSERT(queue.size() == 2 && a.get_state() == TaskState::BLOCKED && b.get_state() == TaskState::BLOCKED, "Waiters must be BLOCKED");
+
+    // 2. 只剩当前任务可运行时阻塞失败，队列不变
+    K_T_ASSERT(!scheduler.block_on(queue) && !queue.contains(&idle) && queue.size() == 2, "Failed block must leave the queue untouched");
+
+    // 3. wake_one 先进先出，被唤醒者经 Strategy 归队
+    K_T_ASSERT(scheduler.wake_one(queue) == &a && a.get_state() == TaskState::READY && a.sched_link.is_linked(), "Oldest waiter must be woken first");
+    K_T_ASSERT(scheduler.resched_pending(), "Waking a task above idle must request a reschedule");
+
+    // 4. wake_all 清空队列
+    strategy.remove_task(&a);
+    scheduler.set_current(&a);
+    K_T_ASSERT(scheduler.wake_all(queue) == 1 && queue.empty() && b.get_state() == TaskState::READY, "wake_all must drain the queue");
+    K_T_ASSERT(!scheduler.wake_one(queue), "Empty queue must wake nobody");
+
+    // 5. 限时等待：到期离队并标记超时；被提前唤醒时定时器一并取消
+    scheduler.set_current(&c);
+    scheduler.on_tick(1); // 截止时间 0 表示不限时：先让时间走起来
+    K_T_ASSERT(!scheduler.block_on(queue, scheduler.now_ms()) && c.wait_timed_out, "Past deadline must not block");
+    K_T_ASSERT(scheduler.block_on(queue, scheduler.now_ms() + 15) && scheduler.has_sleepers(), "Timed wait must arm the timer");
+    scheduler.on_tick(10);
+    K_T_ASSERT(c.get_state() == TaskState::BLOCKED && queue.contains(&c), "Timed waiter must not expire early");
+    scheduler.on_tick(10);
+    K_T_ASSERT(!queue.contains(&c) && c.wait_timed_out && scheduler.get_current() == &c, "Expired waiter must leave the queue and preempt");
+
+    K_T_ASSERT(scheduler.block_on(queue, scheduler.now_ms() + 50), "Timed wait failed");
+    K_T_ASSERT(scheduler.wake_one(queue) == &c && !c.wait_timed_out && !scheduler.has_sleepers(), "Early wake must cancel the timer");
+
+    // 6. 通用 wake 也会把任务从等待队列摘下
+    scheduler.set_current(&c);
+    strategy.make_task_ready(&idle);
+    K_T_ASSERT(scheduler.block_on(queue), "Blocking failed");
+    K_T_ASSERT(scheduler.wake(&c) && queue.empty() && c.sched_link.is_linked(), "wake must detach the task from its wait queue");
+}
+
+/**
+ * 销毁任务：阻塞、睡眠或就绪中的任务都从调度器的全部队列上摘下，之后的唤醒与定时器到期不会让它复活；
+ * 它持有的缓冲授权一并释放
+ */
+inline void unit_test_task_kill_detaches()
+{
+    alignas(64) static uint8_t arena[64 * 1024];
+    TlsfHeapAllocator heap(arena, sizeof(arena));
+    KernelObjectBuilder builder(&heap);
+    auto *bus = builder.construct<MessageBus>(&builder);
+
+    MockTaskContext ctx_root, ctx_waiter, ctx_sleeper, ctx_ready, ctx_idle;
+    TaskExecutionInfo exec{nullptr, nullptr, nullptr};
+    SimpleTaskControlBlock root(1, &ctx_root, exec, TaskResourceConfig(TaskPriority::ROOT, nullptr));
+    SimpleTaskControlBlock waiter(2, &ctx_waiter, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock sleeper(3, &ctx_sleeper, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock ready(4, &ctx_ready, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock idle(5, &ctx_idle, exec, TaskResourceConfig(TaskPriority::IDLE, nullptr));
+
+    PriorityStrategy strategy;
+    PrioritySchedulingPolicy policy;
+    TaskScheduler scheduler(&strategy, &policy);
+    SimpleTaskLifecycle lifecycle(&builder, nullptr);
+    alignas(64) static uint8_t pool[16 * 1024];
+    static BufferGrantTable grants(pool, sizeof(pool));
+    TaskService service(&lifecycle, &strategy, bus, &scheduler, &grants);
+    lifecycle.register_task(&root);
+    lifecycle.register_task(&waiter);
+    lifecycle.register_task(&sleeper);
+    lifecycle.register_task(&ready);
+    service.bind_root_task(&root);
+    strategy.remove_task(&root);
+
+    // 等待者独占一份授权，与根任务共享另一份
+    uint32_t owned = grants.create(1024, waiter.get_id());
+    uint32_t shared = grants.create(1024, waiter.get_id());
+    K_T_ASSERT(grants.retain(shared, waiter.get_id()) && grants.transfer(shared, waiter.get_id(), root.get_id()), "Grant setup failed");
+
+    WaitQueue queue;
+    scheduler.set_current(&idle);
+    scheduler.on_tick(1);
+
+    scheduler.set_current(&waiter);
+    strategy.make_task_ready(&idle);
+    K_T_ASSERT(scheduler.block_on(queue, scheduler.now_ms() + 10), "Waiter must block with a deadline");
+    scheduler.set_current(&sleeper);
+    strategy.make_task_ready(&idle);
+    K_T_ASSERT(scheduler.sleep_current(scheduler.now_ms() + 10), "Sleeper must sleep");
+    scheduler.set_current(&idle);
+    strategy.make_task_ready(&ready);
+
+    // 1. 正在运行的任务不能销毁
+    scheduler.set_current(&ready);
+    service.kill_task_by_id(ready.get_id());
+    K_T_ASSERT(lifecycle.get_task_count() == 4, "Running task must not be destroyed");
+    scheduler.set_current(&idle);
+    strategy.make_task_ready(&ready);
+
+    // 2. 逐个销毁：全部离开就绪队列、等待队列与时间轮
+    service.kill_task_by_id(waiter.get_id());
+    service.kill_task_by_id(sleeper.get_id());
+    service.kill_task_by_id(ready.get_id());
+    K_T_ASSERT(lifecycle.get_task_count() == 1 && queue.empty() && !scheduler.has_sleepers(), "Killed tasks must leave every queue");
+    K_T_ASSERT(strategy.ready_count() == 0 && !waiter.sched_link.is_linked() && !sleeper.timer_link.is_linked(), "Killed tasks must not stay linked");
+    K_T_ASSERT(grants.ref_count(owned) == 0 && grants.ref_count(shared) == 1 && grants.live_count() == 1, "Killed task's grants must be released");
+    K_T_ASSERT(grants.map(shared, root.get_id()) && grants.release(shared, root.get_id()) && grants.live_count() == 0, "Other holders must keep their references");
+
+    // 3. 之后的唤醒与到期都找不到它们
+    K_T_ASSERT(!scheduler.wake_one(queue) && !scheduler.wake(&waiter), "Killed waiter must not be woken");
+    scheduler.on_tick(20);
+    K_T_ASSERT(strategy.ready_count() == 0 && waiter.get_state() == TaskState::DEAD && sleeper.get_state() == TaskState::DEAD, "Killed tasks must never become ready again");
+
+    // 4. 销毁服务端：等待它回复的调用方带着失败返回，而不是永远阻塞
+    SimpleTaskControlBlock server(6, &ctx_waiter, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    SimpleTaskControlBlock caller(7, &ctx_sleeper, exec, TaskResourceConfig(TaskPriority::NORMAL, nullptr));
+    lifecycle.register_task(&server);
+    lifecycle.register_task(&caller);
+    scheduler.set_current(&caller);
+    strategy.make_task_ready(&idle);
+    caller.ipc.ok = true;
+    caller.ipc.wait = IpcWait::Reply;
+    caller.ipc.partner = server.get_id();
+    K_T_ASSERT(scheduler.block_current(), "Caller must block waiting for the reply");
+    scheduler.set_current(&idle);
+    service.kill_task_by_id(server.get_id());
+    K_T_ASSERT(!caller.ipc.ok && caller.ipc.wait == IpcWait::None, "Caller of a killed server must see the call fail");
+    K_T_ASSERT(caller.get_state() == TaskState::READY && caller.sched_link.is_linked(), "Caller of a killed server must be woken");
+
+    builder.destroy(bus);
+}
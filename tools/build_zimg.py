@@ -33,6 +33,8 @@ def get_pe_entry(filename):
     with open(filename, "rb") as f:
         data = f.read(1024)
         if data[:2] != b"MZ":
+            # 非 PE：Linux 构建产出的扁平镜像，入口约定在偏移 0
+            print("[Build] Flat binary detected, entry at offset 0x0")
             return 0
 
         # 获取 PE Header 偏移